@@ -7,6 +7,9 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Optional damage tracking to skip unchanged frames and only redraw changed regions. See ImGui_ImplOpenGL3_SetDamageTracking().
+//  [X] Renderer: Signed distance field text for fonts using ImFontFlags_SDF (ImGuiBackendFlags_RendererHasSdfText) [Not on ES 2.0!]
+//  [X] Renderer: Subpixel text for fonts using ImFontFlags_LCD (ImGuiBackendFlags_RendererHasLcdText) [Desktop OpenGL 3.3+ only!]
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +26,11 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Added subpixel (LCD) text shader using dual-source blending, toggled by ImDrawCallback_BeginLcdText/ImDrawCallback_EndLcdText (ImGuiBackendFlags_RendererHasLcdText). Desktop GL 3.3+ only.
+//  2026-10-18: OpenGL: Added signed distance field text shader path, toggled by ImDrawCallback_BeginSdfText/ImDrawCallback_EndSdfText (ImGuiBackendFlags_RendererHasSdfText).
+//  2026-10-18: OpenGL: Support compact 12 bytes vertex layout enabled with IMGUI_USE_COMPACT_DRAWVERT.
+//  2026-10-18: OpenGL: On GL 4.4+ contexts, upload vertex/index data through persistently mapped and fenced ring buffers instead of calling glBufferData() for every draw list.
+//  2026-10-18: OpenGL: Added optional damage tracking: ImGui_ImplOpenGL3_SetDamageTracking(), ImGui_ImplOpenGL3_ComputeDamage().
 //  2025-12-11: OpenGL: Fixed embedded loader multiple init/shutdown cycles broken on some platforms. (#8792, #9112)
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
 //  2025-07-22: OpenGL: Add and call embedded loader shutdown during ImGui_ImplOpenGL3_Shutdown() to facilitate multiple init/shutdown cycles in same process. (#8792)
@@ -126,6 +134,14 @@
 #include "imgui_impl_opengl3.h"
 #include <stdio.h>
 #include <stdint.h>     // intptr_t
+#include <math.h>       // floorf, ceilf
+#include <float.h>      // FLT_MAX
+#ifndef IM_MAX
+#define IM_MAX(A, B)    (((A) >= (B)) ? (A) : (B))
+#endif
+#ifndef IM_MIN
+#define IM_MIN(A, B)    (((A) < (B)) ? (A) : (B))
+#endif
 #if defined(__APPLE__)
 #include <TargetConditionals.h>
 #endif
@@ -219,6 +235,25 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 4.4+ has glBufferStorage() for persistently mapped buffers, which GL ES and WebGL don't have.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3) && defined(GL_VERSION_4_4)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+#endif
+
+// Desktop GL 3.3+ has dual-source blending, used for subpixel (LCD) text. Our embedded loader doesn't declare its blend factors.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_DUAL_SOURCE_BLEND
+#ifndef GL_SRC1_COLOR
+#define GL_SRC1_COLOR                     0x88F9
+#define GL_ONE_MINUS_SRC1_COLOR           0x88FA
+#endif
+#endif
+
+// Compact vertex layout uses GL_SHORT positions, which our embedded loader doesn't declare.
+#if defined(IMGUI_USE_COMPACT_DRAWVERT) && !defined(GL_SHORT)
+#define GL_SHORT                          0x1402
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -228,6 +263,20 @@
 #define GL_CALL(_CALL)      _CALL   // Call without error check
 #endif
 
+// Damage tracking: number of presented frames we keep the damaged area of (maximum usable buffer age)
+#define IMGUI_IMPL_OPENGL_DAMAGE_HISTORY 4
+
+// Persistently mapped ring buffers: number of frames worth of vertex/index data that may be in flight
+#define IMGUI_IMPL_OPENGL_RING_SEGMENTS 3
+
+// Damage tracking: state of a draw list as submitted in the previous frame
+struct ImGui_ImplOpenGL3_DrawListState
+{
+    const ImDrawList*   DrawList;
+    ImU64               Hash;
+    ImVec4              Bounds;         // Union of the clipping rectangles of its draw commands, restricted to its vertices bounding box (display coordinates)
+};
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
@@ -241,6 +290,12 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
+    GLint           AttribLocationSdfText;
+    GLuint          ShaderLcdHandle;         // Subpixel (LCD) text program, using dual-source blending. Only created when ImGuiBackendFlags_RendererHasLcdText is set.
+    GLint           AttribLocationLcdTex;
+    GLint           AttribLocationLcdProjMtx;
+    bool            SdfTextActive;           // Between ImDrawCallback_BeginSdfText and ImDrawCallback_EndSdfText, restored by ImDrawCallback_ResetRenderState
+    bool            LcdTextActive;           // Between ImDrawCallback_BeginLcdText and ImDrawCallback_EndLcdText, restored by ImDrawCallback_ResetRenderState
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
@@ -251,8 +306,29 @@ struct ImGui_ImplOpenGL3_Data
     bool            HasBindSampler;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+    bool            UseBufferStorage;        // Upload through persistently mapped ring buffers (GL 4.4+). VboHandle/ElementsHandle are then immutable.
     ImVector<char>  TempBuffer;
 
+    // Persistently mapped ring buffers (GL 4.4+). Each frame writes into its own segment, guarded by a fence.
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    ImDrawVert*     RingVtxMapped;
+    ImDrawIdx*      RingIdxMapped;
+    int             RingVtxCapacity;         // Per segment, in vertices
+    int             RingIdxCapacity;         // Per segment, in indices
+    int             RingSegment;             // Segment used by the next RenderDrawData()
+    GLsync          RingFences[IMGUI_IMPL_OPENGL_RING_SEGMENTS];
+#endif
+
+    // Damage tracking (optional, see ImGui_ImplOpenGL3_SetDamageTracking())
+    bool            DamageTracking;
+    int             DamageBufferAge;
+    bool            DamageRectValid;         // Set by ImGui_ImplOpenGL3_ComputeDamage(), consumed by the next RenderDrawData()
+    int             DamageBox[4];            // Area to redraw in the upcoming RenderDrawData(): x1, y1, x2, y2 in framebuffer coordinates (Y down), rounded outward once for both clearing and drawing
+    ImVec4          DamageHistory[IMGUI_IMPL_OPENGL_DAMAGE_HISTORY]; // Damaged area of the last presented frames, most recent first
+    int             DamageHistoryCount;
+    ImVec2          DamageDisplayPos, DamageDisplaySize, DamageFramebufferScale;
+    ImVector<ImGui_ImplOpenGL3_DrawListState> DamageDrawLists; // Matches draw_data->CmdLists[] of the last ComputeDamage() call
+
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
 
@@ -369,6 +445,12 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;       // We can honor ImGuiPlatformIO::Textures[] requests during render.
+    if (!bd->GlProfileIsES2)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfText;    // We can honor ImDrawCallback_BeginSdfText/ImDrawCallback_EndSdfText (needs fwidth(), not available on ES 2.0 without extension).
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_DUAL_SOURCE_BLEND
+    if (bd->GlVersion >= 330 && !bd->GlProfileIsES2 && !bd->GlProfileIsES3)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasLcdText;    // We can honor ImDrawCallback_BeginLcdText/ImDrawCallback_EndLcdText (needs dual-source blending).
+#endif
 
     ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
     platform_io.Renderer_TextureMaxWidth = platform_io.Renderer_TextureMaxHeight = (int)bd->MaxTextureSize;
@@ -404,6 +486,9 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     bd->HasBindSampler = (bd->GlVersion >= 330 || bd->GlProfileIsES3);
 #endif
     bd->HasClipOrigin = (bd->GlVersion >= 450);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    bd->UseBufferStorage = (bd->GlVersion >= 440 && !bd->GlProfileIsES2 && !bd->GlProfileIsES3);
+#endif
 #ifdef IMGUI_IMPL_OPENGL_HAS_EXTENSIONS
     GLint num_extensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
@@ -429,7 +514,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasSdfText | ImGuiBackendFlags_RendererHasLcdText);
     platform_io.ClearRendererHandlers();
     IM_DELETE(bd);
 
@@ -450,6 +535,25 @@ void    ImGui_ImplOpenGL3_NewFrame()
             IM_ASSERT(0 && "ImGui_ImplOpenGL3_CreateDeviceObjects() failed!");
 }
 
+// Apply text rendering state toggled by ImDrawCallback_BeginSdfText/EndSdfText and ImDrawCallback_BeginLcdText/EndLcdText
+static void ImGui_ImplOpenGL3_SetupTextRenderState(ImGui_ImplOpenGL3_Data* bd)
+{
+    glUseProgram(bd->ShaderHandle);
+    glUniform1i(bd->AttribLocationSdfText, bd->SdfTextActive ? 1 : 0);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_DUAL_SOURCE_BLEND
+    // Blend each color channel with its own coverage: dst.rgb = Out_Color.rgb * Out_Blend.rgb + dst.rgb * (1 - Out_Blend.rgb)
+    if (bd->ShaderLcdHandle && bd->LcdTextActive)
+    {
+        glUseProgram(bd->ShaderLcdHandle);
+        glBlendFuncSeparate(GL_SRC1_COLOR, GL_ONE_MINUS_SRC1_COLOR, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    }
+    else if (bd->ShaderLcdHandle)
+    {
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    }
+#endif
+}
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -491,17 +595,31 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float S = 1.0f / (1 << IM_DRAWVERT_POS_FRAC_BITS); // Vertex positions are 16-bit fixed point, relative to IM_DRAWVERT_POS_ORIGIN
+    const float O = IM_DRAWVERT_POS_ORIGIN;
+#else
+    const float S = 1.0f;
+    const float O = 0.0f;
 #endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
-        { 0.0f,         0.0f,        -1.0f,   0.0f },
-        { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
+        { 2.0f*S/(R-L),     0.0f,             0.0f,   0.0f },
+        { 0.0f,             2.0f*S/(T-B),     0.0f,   0.0f },
+        { 0.0f,             0.0f,            -1.0f,   0.0f },
+        { (R+L-2*O)/(L-R),  (T+B-2*O)/(B-T),  0.0f,   1.0f },
     };
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    if (bd->ShaderLcdHandle)
+    {
+        glUseProgram(bd->ShaderLcdHandle);
+        glUniform1i(bd->AttribLocationLcdTex, 0);
+        glUniformMatrix4fv(bd->AttribLocationLcdProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
+    ImGui_ImplOpenGL3_SetupTextRenderState(bd);
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->HasBindSampler)
@@ -519,11 +637,79 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#else
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+static void ImGui_ImplOpenGL3_DestroyRingBuffers()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (GLsync& fence : bd->RingFences)
+        if (fence) { glDeleteSync(fence); fence = nullptr; }
+    if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; } // Also unmaps them
+    if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
+    bd->RingVtxMapped = nullptr;
+    bd->RingIdxMapped = nullptr;
+    bd->RingVtxCapacity = bd->RingIdxCapacity = 0;
+    bd->RingSegment = 0;
+}
+
+// Make the next ring segment available for writing, (re)creating the buffers if they are too small.
+// Buffers are created through the GL_ARRAY_BUFFER target so we don't alter the element array binding of whichever VAO is currently bound.
+static void ImGui_ImplOpenGL3_BeginRingSegment(int vtx_count, int idx_count)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (bd->RingVtxCapacity < vtx_count || bd->RingIdxCapacity < idx_count)
+    {
+        // Replacing the buffers doesn't need to wait: the driver keeps the old storage alive until in-flight draws are done with it.
+        const int vtx_capacity = IM_MAX(IM_MAX(vtx_count + vtx_count / 2, bd->RingVtxCapacity), 16 * 1024);
+        const int idx_capacity = IM_MAX(IM_MAX(idx_count + idx_count / 2, bd->RingIdxCapacity), 32 * 1024);
+        ImGui_ImplOpenGL3_DestroyRingBuffers();
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const GLsizeiptr vtx_buffer_size = (GLsizeiptr)vtx_capacity * IMGUI_IMPL_OPENGL_RING_SEGMENTS * (int)sizeof(ImDrawVert);
+        const GLsizeiptr idx_buffer_size = (GLsizeiptr)idx_capacity * IMGUI_IMPL_OPENGL_RING_SEGMENTS * (int)sizeof(ImDrawIdx);
+        GL_CALL(glGenBuffers(1, &bd->VboHandle));
+        GL_CALL(glGenBuffers(1, &bd->ElementsHandle));
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+        GL_CALL(glBufferStorage(GL_ARRAY_BUFFER, vtx_buffer_size, nullptr, flags));
+        bd->RingVtxMapped = (ImDrawVert*)glMapBufferRange(GL_ARRAY_BUFFER, 0, vtx_buffer_size, flags);
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->ElementsHandle));
+        GL_CALL(glBufferStorage(GL_ARRAY_BUFFER, idx_buffer_size, nullptr, flags));
+        bd->RingIdxMapped = (ImDrawIdx*)glMapBufferRange(GL_ARRAY_BUFFER, 0, idx_buffer_size, flags);
+        if (bd->RingVtxMapped == nullptr || bd->RingIdxMapped == nullptr)
+        {
+            // Mapping failed: permanently fall back to glBufferData() uploads with regular mutable buffers.
+            ImGui_ImplOpenGL3_DestroyRingBuffers();
+            bd->UseBufferStorage = false;
+            glGenBuffers(1, &bd->VboHandle);
+            glGenBuffers(1, &bd->ElementsHandle);
+            return;
+        }
+        bd->RingVtxCapacity = vtx_capacity;
+        bd->RingIdxCapacity = idx_capacity;
+        return;
+    }
+
+    // Wait until the GPU is done reading the data we wrote into this segment IMGUI_IMPL_OPENGL_RING_SEGMENTS frames ago
+    GLsync& fence = bd->RingFences[bd->RingSegment];
+    if (fence)
+    {
+        GLenum wait_result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000); // 1 second
+        while (wait_result == GL_TIMEOUT_EXPIRED)
+            wait_result = glClientWaitSync(fence, 0, 1000000000);
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+#endif
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -592,16 +778,46 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glGenVertexArrays(1, &vertex_array_object));
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->UseBufferStorage)
+        ImGui_ImplOpenGL3_BeginRingSegment(draw_data->TotalVtxCount, draw_data->TotalIdxCount);
+    const bool use_ring = bd->UseBufferStorage;
+    ImDrawVert* ring_vtx_dst = use_ring ? bd->RingVtxMapped + bd->RingSegment * bd->RingVtxCapacity : nullptr;
+    ImDrawIdx* ring_idx_dst = use_ring ? bd->RingIdxMapped + bd->RingSegment * bd->RingIdxCapacity : nullptr;
+    int ring_vtx_offset = bd->RingSegment * bd->RingVtxCapacity;
+    int ring_idx_offset = bd->RingSegment * bd->RingIdxCapacity;
+#endif
+    bd->SdfTextActive = bd->LcdTextActive = false;
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
+    // Damage tracking: only redraw the area computed by ImGui_ImplOpenGL3_ComputeDamage(), if it was called for this frame
+    const bool use_damage_rect = bd->DamageRectValid && bd->DamageDrawLists.Size == draw_data->CmdListsCount;
+    const ImVec4 damage_box((float)bd->DamageBox[0], (float)bd->DamageBox[1], (float)bd->DamageBox[2], (float)bd->DamageBox[3]); // Framebuffer space
+    bd->DamageRectValid = false;
+
     // Render command lists
-    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    for (int draw_list_n = 0; draw_list_n < draw_data->CmdListsCount; draw_list_n++)
     {
+        const ImDrawList* draw_list = draw_data->CmdLists[draw_list_n];
+        if (use_damage_rect)
+        {
+            // Unchanged draw lists outside of the damaged area were left intact in the framebuffer: skip their upload entirely
+            const ImVec4& bounds = bd->DamageDrawLists[draw_list_n].Bounds;
+            if ((bounds.x - clip_off.x) * clip_scale.x >= damage_box.z || (bounds.y - clip_off.y) * clip_scale.y >= damage_box.w ||
+                (bounds.z - clip_off.x) * clip_scale.x <= damage_box.x || (bounds.w - clip_off.y) * clip_scale.y <= damage_box.y)
+                continue;
+        }
+
+        // Offset of this draw list within the vertex/index buffers (only non-zero with ring buffers)
+        unsigned int list_vtx_offset = 0;
+        unsigned int list_idx_offset = 0;
+
         // Upload vertex/index buffers
+        // - On GL 4.4+ we copy every draw list into a persistently mapped ring segment and never call glBufferData() after warm-up.
         // - OpenGL drivers are in a very sorry state nowadays....
         //   During 2021 we attempted to switch from glBufferData() to orphaning+glBufferSubData() following reports
         //   of leaks on Intel GPU when using multi-viewports on Windows.
@@ -611,6 +827,20 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
         const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
         const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+        if (use_ring)
+        {
+            memcpy(ring_vtx_dst, draw_list->VtxBuffer.Data, (size_t)vtx_buffer_size);
+            memcpy(ring_idx_dst, draw_list->IdxBuffer.Data, (size_t)idx_buffer_size);
+            ring_vtx_dst += draw_list->VtxBuffer.Size;
+            ring_idx_dst += draw_list->IdxBuffer.Size;
+            list_vtx_offset = (unsigned int)ring_vtx_offset;
+            list_idx_offset = (unsigned int)ring_idx_offset;
+            ring_vtx_offset += draw_list->VtxBuffer.Size;
+            ring_idx_offset += draw_list->IdxBuffer.Size;
+        }
+        else
+#endif
         if (bd->UseBufferSubData)
         {
             if (bd->VertexBufferSize < vtx_buffer_size)
@@ -641,6 +871,16 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                else if (pcmd->UserCallback == ImDrawCallback_BeginSdfText || pcmd->UserCallback == ImDrawCallback_EndSdfText)
+                {
+                    bd->SdfTextActive = (pcmd->UserCallback == ImDrawCallback_BeginSdfText);
+                    ImGui_ImplOpenGL3_SetupTextRenderState(bd);
+                }
+                else if (pcmd->UserCallback == ImDrawCallback_BeginLcdText || pcmd->UserCallback == ImDrawCallback_EndLcdText)
+                {
+                    bd->LcdTextActive = (pcmd->UserCallback == ImDrawCallback_BeginLcdText);
+                    ImGui_ImplOpenGL3_SetupTextRenderState(bd);
+                }
                 else
                     pcmd->UserCallback(draw_list, pcmd);
             }
@@ -649,6 +889,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // Project scissor/clipping rectangles into framebuffer space
                 ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
                 ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+
+                // Restrict to damaged area, if any: the exact pixels cleared by the application
+                if (use_damage_rect)
+                {
+                    clip_min = ImVec2(IM_MAX(clip_min.x, damage_box.x), IM_MAX(clip_min.y, damage_box.y));
+                    clip_max = ImVec2(IM_MIN(clip_max.x, damage_box.z), IM_MIN(clip_max.y, damage_box.w));
+                }
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
@@ -659,14 +906,23 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)((list_idx_offset + pcmd->IdxOffset) * sizeof(ImDrawIdx)), (GLint)(list_vtx_offset + pcmd->VtxOffset)));
                 else
 #endif
-                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)((list_idx_offset + pcmd->IdxOffset) * sizeof(ImDrawIdx))));
             }
         }
     }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    // Fence the segment we just wrote so we don't overwrite it before the GPU is done with it
+    if (use_ring)
+    {
+        bd->RingFences[bd->RingSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        bd->RingSegment = (bd->RingSegment + 1) % IMGUI_IMPL_OPENGL_RING_SEGMENTS;
+    }
+#endif
+
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
@@ -712,6 +968,166 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     (void)bd; // Not all compilation paths use this
 }
 
+void    ImGui_ImplOpenGL3_SetDamageTracking(bool enabled, int buffer_age)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+    IM_ASSERT(buffer_age >= 0);
+    bd->DamageTracking = enabled;
+    bd->DamageBufferAge = buffer_age;
+    bd->DamageRectValid = false;
+    bd->DamageHistoryCount = 0;
+    bd->DamageDrawLists.clear();
+}
+
+// Word-at-a-time hash, only used to compare a draw list with its previous frame
+static ImU64 ImGui_ImplOpenGL3_HashData(const void* data, size_t size, ImU64 seed)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    ImU64 h = seed ^ ((ImU64)size * 0x9E3779B97F4A7C15ULL);
+    for (; size >= 8; p += 8, size -= 8)
+    {
+        ImU64 k;
+        memcpy(&k, p, 8);
+        h = (h ^ (k * 0xFF51AFD7ED558CCDULL)) * 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 32;
+    }
+    for (; size > 0; p++, size--)
+        h = (h ^ *p) * 0x100000001B3ULL;
+    return h;
+}
+
+static ImVec4 ImGui_ImplOpenGL3_MergeRects(const ImVec4& a, const ImVec4& b)
+{
+    if (a.x >= a.z || a.y >= a.w)
+        return b;
+    if (b.x >= b.z || b.y >= b.w)
+        return a;
+    return ImVec4(IM_MIN(a.x, b.x), IM_MIN(a.y, b.y), IM_MAX(a.z, b.z), IM_MAX(a.w, b.w));
+}
+
+bool    ImGui_ImplOpenGL3_ComputeDamage(ImDrawData* draw_data, int out_scissor_box[4])
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const ImVec4 display_rect(draw_data->DisplayPos.x, draw_data->DisplayPos.y, draw_data->DisplayPos.x + draw_data->DisplaySize.x, draw_data->DisplayPos.y + draw_data->DisplaySize.y);
+    const int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    const int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    out_scissor_box[0] = out_scissor_box[1] = 0;
+    out_scissor_box[2] = fb_width;
+    out_scissor_box[3] = fb_height;
+    if (!bd->DamageTracking)
+        return true;
+
+    // Anything which isn't captured by the draw lists contents invalidates the whole framebuffer:
+    // first frame, display changes, pending texture updates (e.g. new glyphs).
+    bool full_damage = bd->DamageHistoryCount == 0 && bd->DamageDrawLists.Size == 0;
+    if (draw_data->DisplayPos.x != bd->DamageDisplayPos.x || draw_data->DisplayPos.y != bd->DamageDisplayPos.y ||
+        draw_data->DisplaySize.x != bd->DamageDisplaySize.x || draw_data->DisplaySize.y != bd->DamageDisplaySize.y ||
+        draw_data->FramebufferScale.x != bd->DamageFramebufferScale.x || draw_data->FramebufferScale.y != bd->DamageFramebufferScale.y)
+        full_damage = true;
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                full_damage = true;
+    bd->DamageDisplayPos = draw_data->DisplayPos;
+    bd->DamageDisplaySize = draw_data->DisplaySize;
+    bd->DamageFramebufferScale = draw_data->FramebufferScale;
+
+    // Hash every draw list and compare with what was at the same position in the previous frame.
+    // A changed, moved, added or removed draw list damages both its old and new bounds.
+    ImVector<ImGui_ImplOpenGL3_DrawListState> prev_draw_lists;
+    prev_draw_lists.swap(bd->DamageDrawLists);
+    bd->DamageDrawLists.resize(draw_data->CmdListsCount);
+    ImVec4 damage(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int draw_list_n = 0; draw_list_n < draw_data->CmdListsCount; draw_list_n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[draw_list_n];
+        ImGui_ImplOpenGL3_DrawListState& state = bd->DamageDrawLists[draw_list_n];
+        state.DrawList = draw_list;
+        state.Bounds = ImVec4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        ImU64 hash = ImGui_ImplOpenGL3_HashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert), 0);
+        hash = ImGui_ImplOpenGL3_HashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx), hash);
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            // User callbacks may draw anything
+            if (cmd.UserCallback != nullptr && cmd.UserCallback != ImDrawCallback_ResetRenderState && cmd.UserCallback != ImDrawCallback_BeginSdfText && cmd.UserCallback != ImDrawCallback_EndSdfText && cmd.UserCallback != ImDrawCallback_BeginLcdText && cmd.UserCallback != ImDrawCallback_EndLcdText)
+                full_damage = true;
+            if (cmd.ElemCount > 0)
+                state.Bounds = ImGui_ImplOpenGL3_MergeRects(state.Bounds, cmd.ClipRect);
+            // (hash the texture reference rather than GetTexID(): textures may not be created yet)
+            hash = ImGui_ImplOpenGL3_HashData(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+            hash = ImGui_ImplOpenGL3_HashData(&cmd.TexRef._TexData, sizeof(cmd.TexRef._TexData), hash);
+            hash = ImGui_ImplOpenGL3_HashData(&cmd.TexRef._TexID, sizeof(cmd.TexRef._TexID), hash);
+            hash = ImGui_ImplOpenGL3_HashData(&cmd.VtxOffset, sizeof(cmd.VtxOffset), hash);
+            hash = ImGui_ImplOpenGL3_HashData(&cmd.IdxOffset, sizeof(cmd.IdxOffset), hash);
+            hash = ImGui_ImplOpenGL3_HashData(&cmd.ElemCount, sizeof(cmd.ElemCount), hash);
+        }
+        state.Hash = hash;
+
+        // Windows draw their decorations with a clipping rectangle covering the whole viewport: also bound by vertex positions.
+        if (state.Bounds.x < state.Bounds.z && state.Bounds.y < state.Bounds.w)
+        {
+            ImVec4 vtx_bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            for (const ImDrawVert& vtx : draw_list->VtxBuffer)
+            {
+                const float x = vtx.pos.x, y = vtx.pos.y;
+                vtx_bounds.x = IM_MIN(vtx_bounds.x, x); vtx_bounds.y = IM_MIN(vtx_bounds.y, y);
+                vtx_bounds.z = IM_MAX(vtx_bounds.z, x); vtx_bounds.w = IM_MAX(vtx_bounds.w, y);
+            }
+            state.Bounds = ImVec4(IM_MAX(state.Bounds.x, vtx_bounds.x), IM_MAX(state.Bounds.y, vtx_bounds.y), IM_MIN(state.Bounds.z, vtx_bounds.z), IM_MIN(state.Bounds.w, vtx_bounds.w));
+        }
+
+        const ImGui_ImplOpenGL3_DrawListState* prev = (draw_list_n < prev_draw_lists.Size) ? &prev_draw_lists[draw_list_n] : nullptr;
+        if (prev == nullptr || prev->DrawList != draw_list || prev->Hash != hash)
+        {
+            damage = ImGui_ImplOpenGL3_MergeRects(damage, state.Bounds);
+            if (prev != nullptr)
+                damage = ImGui_ImplOpenGL3_MergeRects(damage, prev->Bounds);
+        }
+    }
+    for (int draw_list_n = draw_data->CmdListsCount; draw_list_n < prev_draw_lists.Size; draw_list_n++)
+        damage = ImGui_ImplOpenGL3_MergeRects(damage, prev_draw_lists[draw_list_n].Bounds);
+
+    if (full_damage)
+        damage = display_rect;
+    damage = ImVec4(IM_MAX(damage.x, display_rect.x), IM_MAX(damage.y, display_rect.y), IM_MIN(damage.z, display_rect.z), IM_MIN(damage.w, display_rect.w));
+    if (damage.x >= damage.z || damage.y >= damage.w)
+        return false; // Nothing changed: the frame on screen is still valid
+
+    // The back buffer we are about to draw into misses the changes of the (buffer_age - 1) last presented frames.
+    // With an unknown buffer age, or one older than our history, redraw everything.
+    ImVec4 redraw = damage;
+    if (bd->DamageBufferAge == 0 || bd->DamageBufferAge - 1 > bd->DamageHistoryCount)
+        redraw = display_rect;
+    else
+        for (int n = 0; n < bd->DamageBufferAge - 1; n++)
+            redraw = ImGui_ImplOpenGL3_MergeRects(redraw, bd->DamageHistory[n]);
+    redraw = ImVec4(IM_MAX(redraw.x, display_rect.x), IM_MAX(redraw.y, display_rect.y), IM_MIN(redraw.z, display_rect.z), IM_MIN(redraw.w, display_rect.w));
+
+    for (int n = IMGUI_IMPL_OPENGL_DAMAGE_HISTORY - 1; n > 0; n--)
+        bd->DamageHistory[n] = bd->DamageHistory[n - 1];
+    bd->DamageHistory[0] = damage;
+    bd->DamageHistoryCount = IM_MIN(bd->DamageHistoryCount + 1, IMGUI_IMPL_OPENGL_DAMAGE_HISTORY);
+
+    // Convert to framebuffer coordinates and round outward to cover partially damaged pixels.
+    // RenderDrawData() clips to the same integer rectangle, so it never draws over pixels which weren't cleared.
+    const ImVec2 clip_off = draw_data->DisplayPos;
+    const ImVec2 clip_scale = draw_data->FramebufferScale;
+    int* box = bd->DamageBox;
+    box[0] = IM_MAX((int)floorf((redraw.x - clip_off.x) * clip_scale.x), 0);
+    box[1] = IM_MAX((int)floorf((redraw.y - clip_off.y) * clip_scale.y), 0);
+    box[2] = IM_MIN((int)ceilf((redraw.z - clip_off.x) * clip_scale.x), fb_width);
+    box[3] = IM_MIN((int)ceilf((redraw.w - clip_off.y) * clip_scale.y), fb_height);
+    bd->DamageRectValid = true;
+
+    // Output with Y inverted for glScissor()
+    out_scissor_box[0] = box[0];
+    out_scissor_box[1] = fb_height - box[3];
+    out_scissor_box[2] = box[2] - box[0];
+    out_scissor_box[3] = box[3] - box[1];
+    return true;
+}
+
 static void ImGui_ImplOpenGL3_DestroyTexture(ImTextureData* tex)
 {
     GLuint gl_tex_id = (GLuint)(intptr_t)tex->TexID;
@@ -914,49 +1330,79 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
 
+    // Signed distance field text (ImDrawCallback_BeginSdfText): turn distance into coverage, anti-aliased over about one pixel.
+    // fwidth() isn't available on ES 2.0 without extension: SDF text isn't supported there (see ImGuiBackendFlags_RendererHasSdfText).
+#define IMGUI_IMPL_OPENGL_GLSL_SDF_TEXT \
+        "uniform int SdfText;\n" \
+        "vec4 SdfTextCoverage(vec4 tex)\n" \
+        "{\n" \
+        "#if !defined(GL_ES) || __VERSION__ >= 300\n" \
+        "    if (SdfText != 0)\n" \
+        "    {\n" \
+        "        float w = max(fwidth(tex.a) * 0.5, 0.001);\n" \
+        "        tex.a = smoothstep(0.5 - w, 0.5 + w, tex.a);\n" \
+        "    }\n" \
+        "#endif\n" \
+        "    return tex;\n" \
+        "}\n"
+
     const GLchar* fragment_shader_glsl_120 =
         "#ifdef GL_ES\n"
         "    precision mediump float;\n"
         "#endif\n"
         "uniform sampler2D Texture;\n"
+        IMGUI_IMPL_OPENGL_GLSL_SDF_TEXT
         "varying vec2 Frag_UV;\n"
         "varying vec4 Frag_Color;\n"
         "void main()\n"
         "{\n"
-        "    gl_FragColor = Frag_Color * texture2D(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture2D(Texture, Frag_UV.st);\n"
+        "    tex = SdfTextCoverage(tex);\n"
+        "    gl_FragColor = Frag_Color * tex;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_130 =
         "uniform sampler2D Texture;\n"
+        IMGUI_IMPL_OPENGL_GLSL_SDF_TEXT
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    tex = SdfTextCoverage(tex);\n"
+        "    Out_Color = Frag_Color * tex;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
         "precision mediump float;\n"
         "uniform sampler2D Texture;\n"
+        IMGUI_IMPL_OPENGL_GLSL_SDF_TEXT
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    tex = SdfTextCoverage(tex);\n"
+        "    Out_Color = Frag_Color * tex;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "uniform sampler2D Texture;\n"
+        IMGUI_IMPL_OPENGL_GLSL_SDF_TEXT
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    tex = SdfTextCoverage(tex);\n"
+        "    Out_Color = Frag_Color * tex;\n"
         "}\n";
 
+#undef IMGUI_IMPL_OPENGL_GLSL_SDF_TEXT
+
     // Select shaders matching our GLSL versions
     const GLchar* vertex_shader = nullptr;
     const GLchar* fragment_shader = nullptr;
@@ -1013,10 +1459,88 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
+    bd->AttribLocationSdfText = glGetUniformLocation(bd->ShaderHandle, "SdfText");
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_DUAL_SOURCE_BLEND
+    // Subpixel (LCD) text program. Dual-source blending outputs need GLSL 3.30, regardless of the GLSL version used by the main program.
+    // Vertex attributes use the same locations as the main program, so both can share vertex setup.
+    if (ImGui::GetIO().BackendFlags & ImGuiBackendFlags_RendererHasLcdText)
+    {
+        char vertex_shader_lcd[512];
+        snprintf(vertex_shader_lcd, IM_ARRAYSIZE(vertex_shader_lcd),
+            "#version 330 core\n"
+            "layout (location = %d) in vec2 Position;\n"
+            "layout (location = %d) in vec2 UV;\n"
+            "layout (location = %d) in vec4 Color;\n"
+            "uniform mat4 ProjMtx;\n"
+            "out vec2 Frag_UV;\n"
+            "out vec4 Frag_Color;\n"
+            "void main()\n"
+            "{\n"
+            "    Frag_UV = UV;\n"
+            "    Frag_Color = Color;\n"
+            "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
+            "}\n", (int)bd->AttribLocationVtxPos, (int)bd->AttribLocationVtxUV, (int)bd->AttribLocationVtxColor);
+
+        // Texture RGB holds coverage of each subpixel. Blending happens in gamma space, which makes light-on-dark text look thinner
+        // and dark-on-light text look bolder than intended: compensate by adjusting coverage based on text luminance.
+        const GLchar* fragment_shader_lcd =
+            "#version 330 core\n"
+            "in vec2 Frag_UV;\n"
+            "in vec4 Frag_Color;\n"
+            "uniform sampler2D Texture;\n"
+            "layout (location = 0, index = 0) out vec4 Out_Color;\n"
+            "layout (location = 0, index = 1) out vec4 Out_Blend;\n"
+            "void main()\n"
+            "{\n"
+            "    vec3 coverage = texture(Texture, Frag_UV.st).rgb;\n"
+            "    float luminance = dot(Frag_Color.rgb, vec3(0.2126, 0.7152, 0.0722));\n"
+            "    coverage = pow(coverage, vec3(mix(1.25, 0.80, luminance))) * Frag_Color.a;\n"
+            "    Out_Color = vec4(Frag_Color.rgb, max(coverage.r, max(coverage.g, coverage.b)));\n"
+            "    Out_Blend = vec4(coverage, 1.0);\n"
+            "}\n";
+
+        const GLchar* vertex_shader_lcd_ptr = vertex_shader_lcd;
+        GLuint vert_lcd_handle, frag_lcd_handle;
+        GL_CALL(vert_lcd_handle = glCreateShader(GL_VERTEX_SHADER));
+        glShaderSource(vert_lcd_handle, 1, &vertex_shader_lcd_ptr, nullptr);
+        glCompileShader(vert_lcd_handle);
+        GL_CALL(frag_lcd_handle = glCreateShader(GL_FRAGMENT_SHADER));
+        glShaderSource(frag_lcd_handle, 1, &fragment_shader_lcd, nullptr);
+        glCompileShader(frag_lcd_handle);
+        if (CheckShader(vert_lcd_handle, "LCD text vertex shader") && CheckShader(frag_lcd_handle, "LCD text fragment shader"))
+        {
+            bd->ShaderLcdHandle = glCreateProgram();
+            glAttachShader(bd->ShaderLcdHandle, vert_lcd_handle);
+            glAttachShader(bd->ShaderLcdHandle, frag_lcd_handle);
+            glLinkProgram(bd->ShaderLcdHandle);
+            glDetachShader(bd->ShaderLcdHandle, vert_lcd_handle);
+            glDetachShader(bd->ShaderLcdHandle, frag_lcd_handle);
+            if (!CheckProgram(bd->ShaderLcdHandle, "LCD text shader program"))
+            {
+                glDeleteProgram(bd->ShaderLcdHandle);
+                bd->ShaderLcdHandle = 0;
+            }
+        }
+        glDeleteShader(vert_lcd_handle);
+        glDeleteShader(frag_lcd_handle);
+
+        // Not fatal: fonts using ImFontFlags_LCD fall back to regular rendering.
+        if (bd->ShaderLcdHandle)
+        {
+            bd->AttribLocationLcdTex = glGetUniformLocation(bd->ShaderLcdHandle, "Texture");
+            bd->AttribLocationLcdProjMtx = glGetUniformLocation(bd->ShaderLcdHandle, "ProjMtx");
+        }
+        else
+        {
+            ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererHasLcdText;
+        }
+    }
+#endif
+
     // Create buffers
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
@@ -1037,9 +1561,13 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    ImGui_ImplOpenGL3_DestroyRingBuffers();
+#endif
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->ShaderLcdHandle){ glDeleteProgram(bd->ShaderLcdHandle); bd->ShaderLcdHandle = 0; }
 
     // Destroy all textures
     for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
@@ -7,6 +7,7 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Optional damage tracking to skip unchanged frames and only redraw changed regions. See ImGui_ImplOpenGL3_SetDamageTracking().
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -43,6 +44,16 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyDeviceObjects();
 // (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex);
 
+// (Optional) Damage tracking: skip frames which would render exactly like the one on screen, and only redraw what changed.
+// - Each draw list is hashed (commands, vertices, indices) and compared with the previous frame, changed lists contribute their clipping rectangles to the damaged area.
+// - 'buffer_age' is how many presented frames old the back buffer contents are when you start rendering (e.g. as reported by EGL_EXT_buffer_age/GLX_EXT_buffer_age).
+//   Pass 0 when unknown, which is the case with a plain SDL_GL_SwapWindow(): any change then redraws the whole framebuffer and only unchanged frames are skipped.
+// - After ImGui::Render(), call ImGui_ImplOpenGL3_ComputeDamage(). If it returns false the frame can be skipped entirely: don't clear, don't call RenderDrawData(), don't present.
+//   Otherwise it outputs the damaged rectangle in framebuffer coordinates (x, y, width, height, suitable for glScissor()), to which you should restrict your glClear().
+//   RenderDrawData() then doesn't upload nor draw draw lists outside of that rectangle. It is assumed that every frame for which it returned true gets presented.
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_SetDamageTracking(bool enabled, int buffer_age = 0);
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_ComputeDamage(ImDrawData* draw_data, int out_scissor_box[4]);
+
 // Configuration flags to add in your imconfig file:
 //#define IMGUI_IMPL_OPENGL_ES2     // Enable ES 2 (Auto-detected on Emscripten)
 //#define IMGUI_IMPL_OPENGL_ES3     // Enable ES 3 (Auto-detected on iOS/Android)
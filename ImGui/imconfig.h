@@ -63,9 +63,24 @@
 //---- Pack vertex colors as BGRA8 instead of RGBA8 (to avoid converting from one to another). Need dedicated backend support.
 //#define IMGUI_USE_BGRA_PACKED_COLOR
 
+//---- Use a 12 bytes vertex layout instead of 20 bytes: 16-bit fixed point positions (1/8th pixel precision, -2048..+6143 range) and 16-bit normalized UV.
+// Reduces vertex upload bandwidth, but writing vertices takes ~2x the CPU time and UV can't be used to repeat a texture.
+// Need dedicated backend support (imgui_impl_opengl3 supports it). See ImDrawVert in imgui.h.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Use a word-at-a-time multiplicative hash for ImHashData()/ImHashStr() instead of the CRC32 lookup table (faster on long labels).
+// Ignored when SSE 4.2 is enabled, as hardware CRC32 is faster. Produces different IDs, which invalidates existing .ini data.
+// IDs also differ between little-endian and big-endian platforms, and between builds with and without SSE 4.2.
+//#define IMGUI_USE_FAST_ID_HASH
+
+//---- Use an open-addressing hash table to index ImGuiStorage (default is a sorted vector with binary search lookups).
+// Faster insertion and lookup with large key counts (e.g. tens of thousands of tree nodes), at the cost of extra memory per storage.
+// ImGuiStorage::Data[] is then stored in insertion order rather than sorted by key, until BuildSortByKey() is called.
+//#define IMGUI_USE_HASHED_STORAGE
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
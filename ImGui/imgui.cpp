@@ -1287,6 +1287,7 @@ static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
 static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
+static void             RestoreThreadedDrawLists(ImGuiContext& g);
 
 // Settings
 static void             WindowSettingsHandler_ClearAll(ImGuiContext*, ImGuiSettingsHandler*);
@@ -2157,28 +2158,103 @@ const char* ImStrbol(const char* buf_mid_line, const char* buf_begin) // find be
     return buf_mid_line;
 }
 
-const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
+#ifdef IMGUI_ENABLE_SSE2
+// Same as ImToUpper() on 16 characters: offset 'a'-'z' to the bottom of the signed range so a single signed compare selects them.
+static inline __m128i ImToUpperSSE2(__m128i v)
 {
-    if (!needle_end)
-        needle_end = needle + ImStrlen(needle);
+    const __m128i is_lower = _mm_cmplt_epi8(_mm_add_epi8(v, _mm_set1_epi8((char)(128 - 'a'))), _mm_set1_epi8((char)(-128 + 26)));
+    return _mm_sub_epi8(v, _mm_and_si128(is_lower, _mm_set1_epi8(32)));
+}
+#endif
+#ifdef IMGUI_ENABLE_AVX2
+static inline __m256i ImToUpperAVX2(__m256i v)
+{
+    const __m256i is_lower = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(-128 + 26)), _mm256_add_epi8(v, _mm256_set1_epi8((char)(128 - 'a'))));
+    return _mm256_sub_epi8(v, _mm256_and_si256(is_lower, _mm256_set1_epi8(32)));
+}
+#endif
+
+static inline bool ImStrnieq(const char* str1, const char* str2, size_t count)
+{
+    for (; count > 0; count--)
+        if (ImToUpper(*str1++) != ImToUpper(*str2++))
+            return false;
+    return true;
+}
 
-    const char un0 = (char)ImToUpper(*needle);
-    while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
+// Find 'needle' (of which the caller upper-cased the first and last characters) in a range at least 'needle_len' long.
+// Tests the first and last characters at 16 or 32 positions at a time, and compares the middle characters of candidates only.
+// The remainder is handled by testing the last full block and masking out positions that were already tested.
+static const char* ImStristrEx(const char* haystack, const char* haystack_end, const char* needle, size_t needle_len, char un0, char unl)
+{
+    const char* haystack_last = haystack_end - needle_len; // Last possible match position
+#ifdef IMGUI_ENABLE_AVX2
+    if (haystack_last - haystack >= 31)
+    {
+        const __m256i un0_32 = _mm256_set1_epi8(un0);
+        const __m256i unl_32 = _mm256_set1_epi8(unl);
+        const char* last_block = haystack_last - 31;
+        for (const char* p = haystack; ; p += 32)
+        {
+            const char* block = (p < last_block) ? p : last_block;
+            const __m256i block_first_chars = ImToUpperAVX2(_mm256_loadu_si256((const __m256i*)(const void*)block));
+            const __m256i block_last_chars = ImToUpperAVX2(_mm256_loadu_si256((const __m256i*)(const void*)(block + needle_len - 1)));
+            unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first_chars, un0_32), _mm256_cmpeq_epi8(block_last_chars, unl_32)));
+            mask &= ~0u << (p - block);
+            for (; mask != 0; mask &= mask - 1)
+            {
+                const char* candidate = block + ImCountTrailingZeroes(mask);
+                if (ImStrnieq(candidate + 1, needle + 1, needle_len - 1))
+                    return candidate;
+            }
+            if (block == last_block)
+                return NULL;
+        }
+    }
+#endif
+#ifdef IMGUI_ENABLE_SSE2
+    if (haystack_last - haystack >= 15)
     {
-        if (ImToUpper(*haystack) == un0)
+        const __m128i un0_16 = _mm_set1_epi8(un0);
+        const __m128i unl_16 = _mm_set1_epi8(unl);
+        const char* last_block = haystack_last - 15;
+        for (const char* p = haystack; ; p += 16)
         {
-            const char* b = needle + 1;
-            for (const char* a = haystack + 1; b < needle_end; a++, b++)
-                if (ImToUpper(*a) != ImToUpper(*b))
-                    break;
-            if (b == needle_end)
-                return haystack;
+            const char* block = (p < last_block) ? p : last_block;
+            const __m128i block_first_chars = ImToUpperSSE2(_mm_loadu_si128((const __m128i*)(const void*)block));
+            const __m128i block_last_chars = ImToUpperSSE2(_mm_loadu_si128((const __m128i*)(const void*)(block + needle_len - 1)));
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first_chars, un0_16), _mm_cmpeq_epi8(block_last_chars, unl_16)));
+            mask &= ~0u << (p - block);
+            for (; mask != 0; mask &= mask - 1)
+            {
+                const char* candidate = block + ImCountTrailingZeroes(mask);
+                if (ImStrnieq(candidate + 1, needle + 1, needle_len - 1))
+                    return candidate;
+            }
+            if (block == last_block)
+                return NULL;
         }
-        haystack++;
     }
+#endif
+    for (; haystack <= haystack_last; haystack++)
+        if (ImToUpper(*haystack) == un0 && ImToUpper(haystack[needle_len - 1]) == unl && ImStrnieq(haystack + 1, needle + 1, needle_len - 1))
+            return haystack;
     return NULL;
 }
 
+// A match has to fit entirely before 'haystack_end'.
+const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
+{
+    if (!needle_end)
+        needle_end = needle + ImStrlen(needle);
+    if (!haystack_end)
+        haystack_end = haystack + ImStrlen(haystack);
+    const size_t needle_len = (size_t)(needle_end - needle);
+    if (needle_len == 0 || (size_t)(haystack_end - haystack) < needle_len)
+        return NULL;
+    return ImStristrEx(haystack, haystack_end, needle, needle_len, ImToUpper(needle[0]), ImToUpper(needle_end[-1]));
+}
+
 // Trim str by offsetting contents when there's leading data + writing a \0 at the trailing position. We use this in situation where the cost is negligible.
 void ImStrTrimBlanks(char* buf)
 {
@@ -2303,6 +2379,71 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
+#if defined(IMGUI_USE_FAST_ID_HASH) && defined(IMGUI_USE_LEGACY_CRC32_ADLER)
+#error "IMGUI_USE_FAST_ID_HASH and IMGUI_USE_LEGACY_CRC32_ADLER are mutually exclusive."
+#endif
+
+#ifdef IMGUI_ENABLE_FAST_ID_HASH
+
+static inline ImU64 ImHashRead64(const unsigned char* p)    { ImU64 v; memcpy(&v, p, 8); return v; }
+static inline ImU64 ImHashMix64(ImU64 h, ImU64 v)           { h ^= v * 0x9E3779B97F4A7C15ULL; h = (h << 31) | (h >> 33); return h * 0xC2B2AE3D27D4EB4FULL; }
+static inline ImU64 ImHashReadTail(const unsigned char* p, size_t n) { ImU64 v = 0; for (size_t i = 0; i < n; i++) v |= (ImU64)p[i] << (i * 8); return v; }
+static inline ImU32 ImHashFmix32(ImU32 h)                   { h ^= h >> 16; h *= 0x85EBCA6B; h ^= h >> 13; h *= 0xC2B2AE35; h ^= h >> 16; return h; } // MurmurHash3 finalizer
+
+// Known size hash
+// Word-at-a-time: 8 bytes are mixed into a 64-bit state per step, folded to 32-bit and combined with the seed by a bijective finalizer.
+// Like CRC32: a given input never collides with itself under two different seeds, hashing an empty input returns the seed unchanged,
+// and inputs of up to 8 bytes differing only in their first 4 bytes never collide (e.g. PushID(int) in a loop, or nearby pointers).
+// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
+ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
+{
+    if (data_size == 0)
+        return seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU32 h;
+    if (data_size <= 8)
+    {
+        ImU64 v;
+        if (data_size == 8)
+            v = ImHashRead64(data);
+        else if (data_size == 4)
+            { ImU32 v32; memcpy(&v32, data, 4); v = v32; }
+        else
+            v = ImHashReadTail(data, data_size);
+        h = (ImU32)v ^ ImHashFmix32((ImU32)(v >> 32) ^ ((ImU32)data_size * 0x9E3779B9));
+    }
+    else
+    {
+        ImU64 h64 = (ImU64)data_size * 0x9E3779B97F4A7C15ULL;
+        for (; data_size >= 8; data += 8, data_size -= 8)
+            h64 = ImHashMix64(h64, ImHashRead64(data));
+        if (data_size > 0)
+            h64 = ImHashMix64(h64, ImHashReadTail(data, data_size));
+        h = (ImU32)(h64 >> 32) ^ (ImU32)h64;
+    }
+    return ImHashFmix32(h ^ seed);
+}
+
+// Zero-terminated string hash, with support for ### to reset back to seed value.
+// e.g. "label###id" outputs the same hash as "id" (and "label" is generally displayed by the UI functions)
+// Locate the string end and the last "###" marker first (strlen/memchr are vectorized by the C library), then hash the remaining bytes.
+// Markers are matched left-to-right without overlap, same as the CRC32 version: "####id" hashes as "#id".
+ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    const char* data = data_p;
+    const char* data_end = data_p + (data_size != 0 ? data_size : ImStrlen(data_p));
+    for (const char* p = data_p; (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL; )
+    {
+        if (p + 2 < data_end && p[1] == '#' && p[2] == '#')
+            p = data = p + 3;
+        else
+            p++;
+    }
+    return ImHashData(data, (size_t)(data_end - data), seed);
+}
+
+#else // #ifdef IMGUI_ENABLE_FAST_ID_HASH
+
 #ifndef IMGUI_ENABLE_SSE4_2_CRC
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
@@ -2424,6 +2565,8 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     return ~crc;
 }
 
+#endif // #ifdef IMGUI_ENABLE_FAST_ID_HASH
+
 // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
 // FIXME-OPT: This is not designed to be optimal. Use with care.
 const char* ImHashSkipUncontributingPrefix(const char* label)
@@ -2853,6 +2996,189 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+#ifdef IMGUI_USE_HASHED_STORAGE
+
+// IDs are generally hashes already, but some users store small sequential integers (e.g. ImGuiSelectionBasicStorage with indices): mix bits.
+static inline int ImGuiStorageHashKey(ImGuiID key)
+{
+    key ^= key >> 16;
+    key *= 0x7FEB352Du;
+    key ^= key >> 15;
+    key *= 0x846CA68Bu;
+    key ^= key >> 16;
+    return (int)(key & 0x7FFFFFFF);
+}
+
+// Rebuild hash index from Data[], keeping load factor <= 50%
+void ImGuiStorage::_HashRebuild() const
+{
+    _HashedData = Data.Data;
+    _HashedSize = Data.Size;
+    if (Data.Size == 0)
+    {
+        _HashSlots.clear();
+        return;
+    }
+    int capacity = 16;
+    while (capacity < Data.Size * 2)
+        capacity *= 2;
+    _HashSlots.resize(capacity);
+    memset(_HashSlots.Data, 0, (size_t)_HashSlots.size_in_bytes());
+    const int mask = capacity - 1;
+    for (int n = 0; n < Data.Size; n++)
+    {
+        int slot = ImGuiStorageHashKey(Data.Data[n].key) & mask;
+        while (_HashSlots.Data[slot].val_i != 0)
+            slot = (slot + 1) & mask;
+        _HashSlots.Data[slot].key = Data.Data[n].key;
+        _HashSlots.Data[slot].val_i = n + 1;
+    }
+}
+
+// Slots store their key, so the probe sequence never touches Data[] until a match is found.
+// The match is then verified against Data[]: if it doesn't agree, Data[] was reordered in place
+// (e.g. ImGuiSelectionBasicStorage::GetNextSelectedItem() sorting by selection order) and we rebuild.
+ImGuiStoragePair* ImGuiStorage::_HashFind(ImGuiID key) const
+{
+    if (Data.Size == 0)
+        return NULL;
+    if (_HashedData != Data.Data || _HashedSize != Data.Size)
+        _HashRebuild();
+    const int mask = _HashSlots.Size - 1;
+    for (int slot = ImGuiStorageHashKey(key) & mask; _HashSlots.Data[slot].val_i != 0; slot = (slot + 1) & mask)
+    {
+        if (_HashSlots.Data[slot].key != key)
+            continue;
+        ImGuiStoragePair* it = const_cast<ImGuiStoragePair*>(&Data.Data[_HashSlots.Data[slot].val_i - 1]);
+        if (it->key == key)
+            return it;
+        _HashRebuild();
+        return _HashFind(key);
+    }
+    return NULL;
+}
+
+// Append a new pair, which must not already exist. Its value is zero-initialized.
+ImGuiStoragePair* ImGuiStorage::_HashInsert(ImGuiID key)
+{
+    if (_HashedData != Data.Data || _HashedSize != Data.Size)
+        _HashRebuild();
+    Data.push_back(ImGuiStoragePair(key, (void*)NULL));
+    if (Data.Size * 2 > _HashSlots.Size)
+    {
+        _HashRebuild();
+        return &Data.back();
+    }
+    const int mask = _HashSlots.Size - 1;
+    int slot = ImGuiStorageHashKey(key) & mask;
+    while (_HashSlots.Data[slot].val_i != 0)
+        slot = (slot + 1) & mask;
+    _HashSlots.Data[slot].key = key;
+    _HashSlots.Data[slot].val_i = Data.Size;
+    _HashedData = Data.Data;
+    _HashedSize = Data.Size;
+    return &Data.back();
+}
+
+void ImGuiStorage::BuildSortByKey()
+{
+    ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    _HashRebuild();
+}
+
+int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
+{
+    ImGuiStoragePair* it = _HashFind(key);
+    return it ? it->val_i : default_val;
+}
+
+bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
+{
+    return GetInt(key, default_val ? 1 : 0) != 0;
+}
+
+float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
+{
+    ImGuiStoragePair* it = _HashFind(key);
+    return it ? it->val_f : default_val;
+}
+
+void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
+{
+    ImGuiStoragePair* it = _HashFind(key);
+    return it ? it->val_p : NULL;
+}
+
+// References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
+int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
+{
+    ImGuiStoragePair* it = _HashFind(key);
+    if (it == NULL)
+    {
+        it = _HashInsert(key);
+        it->val_i = default_val;
+    }
+    return &it->val_i;
+}
+
+bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
+{
+    return (bool*)GetIntRef(key, default_val ? 1 : 0);
+}
+
+float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
+{
+    ImGuiStoragePair* it = _HashFind(key);
+    if (it == NULL)
+    {
+        it = _HashInsert(key);
+        it->val_f = default_val;
+    }
+    return &it->val_f;
+}
+
+void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
+{
+    ImGuiStoragePair* it = _HashFind(key);
+    if (it == NULL)
+    {
+        it = _HashInsert(key);
+        it->val_p = default_val;
+    }
+    return &it->val_p;
+}
+
+void ImGuiStorage::SetInt(ImGuiID key, int val)
+{
+    ImGuiStoragePair* it = _HashFind(key);
+    if (it == NULL)
+        it = _HashInsert(key);
+    it->val_i = val;
+}
+
+void ImGuiStorage::SetBool(ImGuiID key, bool val)
+{
+    SetInt(key, val ? 1 : 0);
+}
+
+void ImGuiStorage::SetFloat(ImGuiID key, float val)
+{
+    ImGuiStoragePair* it = _HashFind(key);
+    if (it == NULL)
+        it = _HashInsert(key);
+    it->val_f = val;
+}
+
+void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
+{
+    ImGuiStoragePair* it = _HashFind(key);
+    if (it == NULL)
+        it = _HashInsert(key);
+    it->val_p = val;
+}
+
+#else // #ifdef IMGUI_USE_HASHED_STORAGE
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -2951,6 +3277,8 @@ void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
         it->val_p = val;
 }
 
+#endif // #ifdef IMGUI_USE_HASHED_STORAGE
+
 void ImGuiStorage::SetAllInt(int v)
 {
     for (int i = 0; i < Data.Size; i++)
@@ -3029,23 +3357,20 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 
     if (text == NULL)
         text = text_end = "";
+    if (text_end == NULL)
+        text_end = text + ImStrlen(text);
+    const size_t text_len = (size_t)(text_end - text);
 
+    // Terms are tested in order and the first match decides.
     for (const ImGuiTextRange& f : Filters)
     {
-        if (f.b == f.e)
+        const bool subtract = (f.b != f.e && f.b[0] == '-');
+        const char* needle = subtract ? f.b + 1 : f.b;
+        const size_t needle_len = (size_t)(f.e - needle);
+        if (needle_len == 0 || needle_len > text_len)
             continue;
-        if (f.b[0] == '-')
-        {
-            // Subtract
-            if (ImStristr(text, text_end, f.b + 1, f.e) != NULL)
-                return false;
-        }
-        else
-        {
-            // Grep
-            if (ImStristr(text, text_end, f.b, f.e) != NULL)
-                return true;
-        }
+        if (ImStristrEx(text, text_end, needle, needle_len, ImToUpper(needle[0]), ImToUpper(f.e[-1])) != NULL)
+            return !subtract; // Grep passes, Subtract rejects
     }
 
     // Implicit * grep
@@ -3138,6 +3463,34 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
             Offsets.push_back((int)(intptr_t)(p - base));
     EndOffset = ImMax(EndOffset, new_size);
 }
+
+void ImGuiTextIndexFilter::update(const ImGuiTextFilter& filter, ImGuiTextIndex& index, const char* base)
+{
+    const bool filter_active = filter.IsActive();
+    const ImGuiID filter_hash = filter_active ? ImHashStr(filter.InputBuf) : 0;
+    if (filter_active != FilterActive || filter_hash != FilterHash || index.size() < SrcLinesCount)
+    {
+        clear();
+        FilterActive = filter_active;
+        FilterHash = filter_hash;
+    }
+    if (!FilterActive)
+    {
+        SrcLinesCount = index.size();
+        return;
+    }
+
+    // Last line may have been incomplete and received more text since: test it again.
+    if (SrcLinesCount > 0)
+    {
+        SrcLinesCount--;
+        if (LineNos.Size > 0 && LineNos.back() == SrcLinesCount)
+            LineNos.pop_back();
+    }
+    for (; SrcLinesCount < index.size(); SrcLinesCount++)
+        if (filter.PassFilter(index.get_line_begin(base, SrcLinesCount), index.get_line_end(base, SrcLinesCount)))
+            LineNos.push_back(SrcLinesCount);
+}
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 //-----------------------------------------------------------------------------
@@ -4112,6 +4465,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
     if (shared_font_atlas == NULL)
         IO.Fonts->OwnerContext = this;
+    ThreadedDrawListsCount = 0;
+    ThreadedDrawListsRecording = false;
     WithinEndChildID = 0;
     TestEngine = NULL;
 
@@ -4401,6 +4756,9 @@ void ImGui::Shutdown()
         }
     }
     g.DrawListSharedData.TempBuffer.clear();
+    RestoreThreadedDrawLists(g);
+    g.ThreadedDrawLists.clear_delete();
+    g.ThreadedDrawListsCount = 0;
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -4468,6 +4826,7 @@ void ImGui::Shutdown()
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
     g.DebugLogIndex.clear();
+    g.DebugLogIndexFilter.clear();
 
     g.Initialized = false;
 }
@@ -4594,6 +4953,7 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
     window->DC.ChildWindows.clear();
+    window->DC.ThreadedDrawLists.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
 }
@@ -5024,7 +5384,8 @@ void* ImGui::MemAlloc(size_t size)
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
-        DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (!ctx->ThreadedDrawListsRecording)
+            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
 #endif
     return ptr;
 }
@@ -5035,7 +5396,8 @@ void ImGui::MemFree(void* ptr)
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ptr != NULL)
         if (ImGuiContext* ctx = GImGui)
-            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+            if (!ctx->ThreadedDrawListsRecording)
+                DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
 #endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
@@ -5179,6 +5541,68 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+void ImGui::AddThreadedDrawList(ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(draw_list != NULL && draw_list != window->DrawList);
+    IM_ASSERT(draw_list->_Data == &g.DrawListSharedData && "Draw list needs to be created with GetDrawListSharedData(), and can only be added once per frame.");
+
+    if (g.ThreadedDrawListsCount == g.ThreadedDrawLists.Size)
+        g.ThreadedDrawLists.push_back(IM_NEW(ImGuiThreadedDrawList)());
+    ImGuiThreadedDrawList* entry = g.ThreadedDrawLists[g.ThreadedDrawListsCount++];
+    entry->DrawList = draw_list;
+    window->DC.ThreadedDrawLists.push_back(draw_list);
+    entry->Recording = true;
+    if (!g.ThreadedDrawListsRecording) // Only write once: workers started for previous lists may be reading it
+        g.ThreadedDrawListsRecording = true;
+
+    // Copy everything ImDrawList functions may read, except the lists of draw lists and the scratch buffer.
+    // The draw list is unregistered from the context's shared data until Render(), so atlas updates don't touch it while recording.
+    const ImDrawListSharedData* src = &g.DrawListSharedData;
+    ImDrawListSharedData* dst = &entry->SharedData;
+    dst->TexUvWhitePixel = src->TexUvWhitePixel;
+    if (src->TexUvLines != NULL)
+        memcpy(entry->TexUvLines, src->TexUvLines, sizeof(entry->TexUvLines));
+    dst->TexUvLines = (src->TexUvLines != NULL) ? entry->TexUvLines : NULL;
+    dst->FontAtlas = src->FontAtlas;
+    dst->Font = src->Font;
+    dst->FontSize = src->FontSize;
+    dst->FontScale = src->FontScale;
+    dst->CurveTessellationTol = src->CurveTessellationTol;
+    dst->CircleSegmentMaxError = src->CircleSegmentMaxError;
+    dst->InitialFringeScale = src->InitialFringeScale;
+    dst->InitialFlags = src->InitialFlags;
+    dst->ClipRectFullscreen = src->ClipRectFullscreen;
+    dst->Context = src->Context;
+    memcpy(dst->ArcFastVtx, src->ArcFastVtx, sizeof(dst->ArcFastVtx));
+    dst->ArcFastRadiusCutoff = src->ArcFastRadiusCutoff;
+    memcpy(dst->CircleSegmentCounts, src->CircleSegmentCounts, sizeof(dst->CircleSegmentCounts));
+
+    draw_list->_SetDrawListSharedData(dst);
+    draw_list->_ResetForNewFrame();
+    draw_list->PushTexture(g.Font->OwnerAtlas->TexRef);
+    draw_list->PushClipRect(window->DrawList->GetClipRectMin(), window->DrawList->GetClipRectMax());
+    draw_list->_OwnerName = window->Name;
+}
+
+// Give threaded draw lists back to the context's shared data. Called by Render(), after workers are done.
+static void RestoreThreadedDrawLists(ImGuiContext& g)
+{
+    g.ThreadedDrawListsRecording = false;
+    for (int n = 0; n < g.ThreadedDrawListsCount; n++)
+    {
+        ImGuiThreadedDrawList* entry = g.ThreadedDrawLists[n];
+        if (!entry->Recording)
+            continue;
+        entry->Recording = false;
+        // Commands keep referencing the atlas texture from when recording started, even if the main thread
+        // has grown or repacked the atlas meanwhile: recorded UVs only match that texture's layout, and it is
+        // kept alive until next frame. Texture contents can only move in place in NewFrame() (defragmentation).
+        entry->DrawList->_SetDrawListSharedData(&g.DrawListSharedData);
+    }
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -5427,6 +5851,10 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfText)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowSdfText;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasLcdText)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowLcdText;
     g.DrawListSharedData.InitialFringeScale = 1.0f; // FIXME-DPI: Change this for some DPI scaling experiments.
 }
 
@@ -5454,6 +5882,8 @@ void ImGui::NewFrame()
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
+    RestoreThreadedDrawLists(g); // In case Render() wasn't called
+    g.ThreadedDrawListsCount = 0;
 
     // Calculate frame-rate for the user, as a purely luxurious feature
     g.FramerateSecPerFrameAccum += g.IO.DeltaTime - g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx];
@@ -5748,6 +6178,8 @@ static void AddWindowToDrawData(ImGuiWindow* window, int layer)
     if (window->DrawList->_Splitter._Count > 1)
         window->DrawList->ChannelsMerge(); // Merge if user forgot to merge back. Also required in Docking branch for ImGuiWindowFlags_DockNodeHost windows.
     ImGui::AddDrawListToDrawDataEx(&viewport->DrawDataP, viewport->DrawDataBuilder.Layers[layer], window->DrawList);
+    for (ImDrawList* draw_list : window->DC.ThreadedDrawLists)
+        ImGui::AddDrawListToDrawDataEx(&viewport->DrawDataP, viewport->DrawDataBuilder.Layers[layer], draw_list);
     for (ImGuiWindow* child : window->DC.ChildWindows)
         if (IsWindowActiveAndVisible(child)) // Clipped children may have been marked not active
             AddWindowToDrawData(child, layer);
@@ -6025,6 +6457,7 @@ void ImGui::Render()
 
     g.IO.MetricsRenderWindows = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
+    RestoreThreadedDrawLists(g);
 
     // Add background ImDrawList (for each active viewport)
     for (ImGuiViewportP* viewport : g.Viewports)
@@ -7959,6 +8392,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.TreeDepth = 0;
         window->DC.TreeHasStackDataDepthMask = window->DC.TreeRecordsClippedNodesY2Mask = 0x00;
         window->DC.ChildWindows.resize(0);
+        window->DC.ThreadedDrawLists.resize(0);
         window->DC.StateStorage = &window->StateStorage;
         window->DC.CurrentColumns = NULL;
         window->DC.LayoutType = ImGuiLayoutType_Vertical;
@@ -8844,10 +9278,27 @@ static void ImGui::UpdateTexturesNewFrame()
     // Cannot update every atlases based on atlas's FrameCount < g.FrameCount, because an atlas may be shared by multiple contexts with different frame count.
     ImGuiContext& g = *GImGui;
     const bool has_textures = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) != 0;
+    const bool has_sdf_text = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfText) != 0;
+    const bool has_lcd_text = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasLcdText) != 0;
     for (ImFontAtlas* atlas : g.FontAtlases)
     {
         if (atlas->OwnerContext == &g)
         {
+            // Fonts using ImFontFlags_SDF need to be baked again when renderer support changes
+            if (atlas->RendererHasSdfText != has_sdf_text)
+            {
+                atlas->RendererHasSdfText = has_sdf_text;
+                for (ImFont* font : atlas->Fonts)
+                    if (font->Flags & ImFontFlags_SDF)
+                        ImFontAtlasFontDiscardBakes(atlas, font, 0);
+            }
+            if (atlas->RendererHasLcdText != has_lcd_text)
+            {
+                atlas->RendererHasLcdText = has_lcd_text;
+                for (ImFont* font : atlas->Fonts)
+                    if (font->Flags & ImFontFlags_LCD)
+                        ImFontAtlasFontDiscardBakes(atlas, font, 0);
+            }
             ImFontAtlasUpdateNewFrame(atlas, g.FrameCount, has_textures);
         }
         else
@@ -16291,6 +16742,26 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     const int discarded_surface_sqrt = (int)sqrtf((float)atlas->Builder->RectsDiscardedSurface);
     Text("Packed rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsPackedCount, atlas->Builder->RectsPackedSurface, packed_surface_sqrt, packed_surface_sqrt);
     Text("incl. Discarded rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsDiscardedCount, atlas->Builder->RectsDiscardedSurface, discarded_surface_sqrt, discarded_surface_sqrt);
+    Text("Free rects: %d, area: %d px. Skyline nodes: %d. Defrag moved %d rects.", atlas->Builder->PackFreeRects.Size, atlas->Builder->PackFreeSurface, atlas->Builder->PackSkyline.Size, atlas->Builder->PackDefragMovedCount);
+    if (atlas->Builder->Pages.Size > 0)
+        Text("Pages: %d (%dx%d), packing into page %d.", atlas->Builder->Pages.Size, atlas->TexData->Width, atlas->TexData->Height, atlas->Builder->PagesCurrent);
+    CheckboxFlags("Use text size cache", &atlas->Flags, ImFontAtlasFlags_UseTextSizeCache);
+    if (atlas->Flags & ImFontAtlasFlags_UseTextSizeCache)
+    {
+        int hit_count = 0, miss_count = 0;
+        for (int baked_n = 0; baked_n < atlas->Builder->BakedPool.Size; baked_n++)
+            if (ImFontBakedTextSizeCache* text_size_cache = atlas->Builder->BakedPool[baked_n].TextSizeCache)
+            {
+                hit_count += text_size_cache->HitCount;
+                miss_count += text_size_cache->MissCount;
+            }
+        SameLine();
+        Text("%d hits, %d misses (%.1f%% hit rate)", hit_count, miss_count, (hit_count + miss_count) > 0 ? hit_count * 100.0f / (hit_count + miss_count) : 0.0f);
+    }
+    if (atlas->GlyphJobDispatchFunc != NULL)
+        Text("Glyph jobs: %d pending, %d completed", atlas->Builder->GlyphJobs.Size, atlas->Builder->GlyphJobsCompletedCount);
+    if (ImFontAtlasGlyphCache* glyph_cache = atlas->GlyphCache)
+        Text("Glyph cache: %d entries (%d KB), loaded %d glyphs in %d baked fonts", glyph_cache->EntriesMap.Data.Size, glyph_cache->Data.Size / 1024, glyph_cache->GlyphsLoadedCount, glyph_cache->BakedLoadedCount);
 
     ImFontAtlasRectId highlight_r_id = ImFontAtlasRectId_Invalid;
     if (TreeNode("Rects Index", "Rects Index (%d)", atlas->Builder->RectsPackedCount)) // <-- Use count of used rectangles
@@ -16311,7 +16782,7 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
                     if (IsItemHovered())
                         highlight_r_id = id;
                     TableNextColumn();
-                    Image(atlas->TexRef, ImVec2(r.w, r.h), r.uv0, r.uv1);
+                    Image(ImFontAtlasPackGetPageTexture(atlas, ImFontAtlasPackGetRectPage(atlas, id))->GetTexRef(), ImVec2(r.w, r.h), r.uv0, r.uv1);
                 }
             EndTable();
         }
@@ -16322,13 +16793,17 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     // Texture list
     // (ensure the last texture always use the same ID, so we can keep it open neatly)
     ImFontAtlasRect highlight_r;
+    ImTextureData* highlight_tex = NULL;
     if (highlight_r_id != ImFontAtlasRectId_Invalid)
+    {
         atlas->GetCustomRect(highlight_r_id, &highlight_r);
+        highlight_tex = ImFontAtlasPackGetPageTexture(atlas, ImFontAtlasPackGetRectPage(atlas, highlight_r_id));
+    }
     for (int tex_n = 0; tex_n < atlas->TexList.Size; tex_n++)
     {
         if (tex_n == atlas->TexList.Size - 1)
             SetNextItemOpen(true, ImGuiCond_Once);
-        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_r_id != ImFontAtlasRectId_Invalid) ? &highlight_r : NULL);
+        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_tex == atlas->TexList[tex_n]) ? &highlight_r : NULL);
     }
 }
 
@@ -17100,9 +17575,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                    const ImVec2 uv = v.uv;
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -17296,6 +17772,8 @@ void ImGui::DebugNodeFont(ImFont* font)
             const int surface_sqrt = (int)ImSqrt((float)baked->MetricsTotalSurface);
             Text("Ascent: %f, Descent: %f, Ascent-Descent: %f", baked->Ascent, baked->Descent, baked->Ascent - baked->Descent);
             Text("Texture Area: about %d px ~%dx%d px", baked->MetricsTotalSurface, surface_sqrt, surface_sqrt);
+            if (ImFontBakedTextSizeCache* text_size_cache = baked->TextSizeCache)
+                Text("Text size cache: %d hits, %d misses, %d+%d entries (%d KB)", text_size_cache->HitCount, text_size_cache->MissCount, IM_FONTBAKED_TEXT_SIZE_CACHE_SHORT_ENTRIES, text_size_cache->Entries.Size, (int)(sizeof(*text_size_cache) + text_size_cache->Entries.size_in_bytes()) / 1024);
             for (int src_n = 0; src_n < font->Sources.Size; src_n++)
             {
                 ImFontConfig* src = font->Sources[src_n];
@@ -17377,6 +17855,8 @@ void ImGui::DebugNodeFontGlyph(ImFont* font, const ImFontGlyph* glyph)
     {
         ImTextureRect* r = ImFontAtlasPackGetRect(font->OwnerAtlas, glyph->PackId);
         Text("PackId: 0x%X (%dx%d rect at %d,%d)", glyph->PackId, r->w, r->h, r->x, r->y);
+        if (font->OwnerAtlas->Builder->Pages.Size > 0)
+            Text("PageIndex: %d", glyph->PageIndex);
     }
     Text("SourceIdx: %d", glyph->SourceIdx);
 }
@@ -17674,6 +18154,7 @@ void ImGui::ShowDebugLogWindow(bool* p_open)
     {
         g.DebugLogBuf.clear();
         g.DebugLogIndex.clear();
+        g.DebugLogIndexFilter.clear();
         g.DebugLogSkippedErrors = 0;
     }
     SameLine();
@@ -17695,17 +18176,24 @@ void ImGui::ShowDebugLogWindow(bool* p_open)
 #endif
         EndPopup();
     }
+    SameLine();
+    g.DebugLogFilter.Draw("Filter", GetFontSize() * 16);
 
     BeginChild("##log", ImVec2(0.0f, 0.0f), ImGuiChildFlags_Borders, ImGuiWindowFlags_AlwaysVerticalScrollbar | ImGuiWindowFlags_AlwaysHorizontalScrollbar);
 
     const ImGuiDebugLogFlags backup_log_flags = g.DebugLogFlags;
     g.DebugLogFlags &= ~ImGuiDebugLogFlags_EventClipper;
 
+    ImGuiTextIndexFilter* index_filter = &g.DebugLogIndexFilter;
+    index_filter->update(g.DebugLogFilter, g.DebugLogIndex, g.DebugLogBuf.c_str());
     ImGuiListClipper clipper;
-    clipper.Begin(g.DebugLogIndex.size());
+    clipper.Begin(index_filter->size());
     while (clipper.Step())
-        for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+        {
+            const int line_no = index_filter->get_line_no(n);
             DebugTextUnformattedWithLocateItem(g.DebugLogIndex.get_line_begin(g.DebugLogBuf.c_str(), line_no), g.DebugLogIndex.get_line_end(g.DebugLogBuf.c_str(), line_no));
+        }
     g.DebugLogFlags = backup_log_flags;
     if (GetScrollY() >= GetScrollMaxY())
         SetScrollHereY(1.0f);
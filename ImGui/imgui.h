@@ -174,12 +174,15 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontAtlasBuilder;          // Opaque storage for building a ImFontAtlas
+struct ImFontAtlasGlyphCache;       // Opaque storage for rasterized glyphs saved/loaded across sessions, see ImFontAtlas::LoadGlyphCacheFromDisk()
+struct ImFontAtlasGlyphJob;         // Opaque glyph rasterization job, see ImFontAtlas::GlyphJobDispatchFunc
 struct ImFontAtlasRect;             // Output of ImFontAtlas::GetCustomRect() when using custom rectangles.
 struct ImFontBaked;                 // Baked data for a ImFont at a given size.
+struct ImFontBakedTextSizeCache;    // Opaque cache of text sizes measured with a ImFontBaked, see ImFontAtlasFlags_UseTextSizeCache
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
@@ -1028,6 +1031,16 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // this draw list will be the first rendered one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
 
+    // Threaded Draw Lists (EXPERIMENTAL)
+    // - Record custom drawing for the current window on another thread (e.g. heavy plots), while the main thread keeps submitting UI.
+    // - Main thread: create the ImDrawList with GetDrawListSharedData() and call AddThreadedDrawList() between Begin()/End(), then hand it to a worker.
+    //   It is rendered right after the window's own draw list (over the window contents, under its child windows), in call order.
+    //   All workers must have finished before calling ImGui::Render().
+    // - Worker thread: only use ImDrawList functions, except AddText() which may load glyphs into the font atlas. Never call ImGui:: functions.
+    //   The draw list records against a private copy of the shared data (UVs, tessellation tables, scratch buffer) made by AddThreadedDrawList().
+    //   Your memory allocator (see SetAllocatorFunctions()) needs to be thread-safe. Metrics allocation counters ignore allocations until Render().
+    IMGUI_API void          AddThreadedDrawList(ImDrawList* draw_list);
+
     // Miscellaneous Utilities
     IMGUI_API bool          IsRectVisible(const ImVec2& size);                                  // test if rectangle (of given size, starting from cursor position) is visible / not clipped.
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
@@ -1720,6 +1733,8 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
     ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasSdfText    = 1 << 5,   // Backend Renderer supports ImDrawCallback_BeginSdfText/ImDrawCallback_EndSdfText. This enables fonts using ImFontFlags_SDF to be baked once and scaled at render time.
+    ImGuiBackendFlags_RendererHasLcdText    = 1 << 6,   // Backend Renderer supports ImDrawCallback_BeginLcdText/ImDrawCallback_EndLcdText. This enables fonts using ImFontFlags_LCD to be rasterized with per-subpixel coverage.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2767,6 +2782,7 @@ struct ImGuiStoragePair
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// With '#define IMGUI_USE_HASHED_STORAGE', Data[] is additionally indexed by an open-addressing hash table: O(1) insertion and lookup, Data[] is kept in insertion order.
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2775,11 +2791,25 @@ struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    mutable ImVector<ImGuiStoragePair> _HashSlots;  // Key + Index+1 into Data[] (val_i == 0 for empty slot). Power of two size, linear probing.
+    mutable const ImGuiStoragePair* _HashedData;    // Data.Data and Data.Size when _HashSlots was last built. Modifying Data[] directly (e.g. push_back) triggers a rebuild on next access.
+                                                    // Reordering Data[] in place (e.g. ImQsort) is detected on lookup, as slots also store their key. Don't change keys in place.
+    mutable int                     _HashedSize;
+    ImGuiStorage()                  { _HashedData = NULL; _HashedSize = 0; }
+    IMGUI_API ImGuiStoragePair*     _HashFind(ImGuiID key) const;
+    IMGUI_API ImGuiStoragePair*     _HashInsert(ImGuiID key);
+    IMGUI_API void                  _HashRebuild() const;
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+#ifdef IMGUI_USE_HASHED_STORAGE
+    void                Clear() { Data.clear(); _HashSlots.clear(); }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -3136,6 +3166,17 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // Render state is not reset by default because they are many perfectly useful way of altering render state (e.g. changing shader/blending settings before an Image call).
 #define ImDrawCallback_ResetRenderState     (ImDrawCallback)(-8)
 
+// Special Draw callback values emitted around text using a font with ImFontFlags_SDF, when 'io.BackendFlags & ImGuiBackendFlags_RendererHasSdfText' is set.
+// Commands in between sample a signed distance field: texture alpha is 0.5 on glyph edges, and the backend needs to turn that into coverage (e.g. using smoothstep() + fwidth() in a shader).
+#define ImDrawCallback_BeginSdfText         (ImDrawCallback)(-9)
+#define ImDrawCallback_EndSdfText           (ImDrawCallback)(-10)
+
+// Special Draw callback values emitted around text using a font with ImFontFlags_LCD, when 'io.BackendFlags & ImGuiBackendFlags_RendererHasLcdText' is set.
+// Commands in between sample per-subpixel coverage: texture R/G/B hold coverage of the left/middle/right subpixel, and texture alpha their average.
+// The backend needs to blend each color channel with its own coverage (e.g. using dual-source blending).
+#define ImDrawCallback_BeginLcdText         (ImDrawCallback)(-11)
+#define ImDrawCallback_EndLcdText           (ImDrawCallback)(-12)
+
 // Typically, 1 command = 1 GPU draw call (unless command is a callback)
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
@@ -3161,13 +3202,68 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
 struct ImDrawVert
 {
     ImVec2  pos;
     ImVec2  uv;
     ImU32   col;
 };
+#elif defined(IMGUI_USE_COMPACT_DRAWVERT)
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT can't be used together."
+#endif
+// Compact vertex layout (12 bytes instead of 20), enabled with '#define IMGUI_USE_COMPACT_DRAWVERT' in imconfig.h.
+// - pos: signed 16-bit fixed point with IM_DRAWVERT_POS_FRAC_BITS fractional bits, relative to IM_DRAWVERT_POS_ORIGIN.
+//   Default is 1/8th of a pixel over a -2048..+6143 range: displays up to 6144 pixels wide, with 2048 pixels of margin on the left/top for partially visible shapes.
+//   '#define IM_DRAWVERT_POS_FRAC_BITS 2' for 1/4th of a pixel over a -6144..+10239 range (e.g. 8K displays).
+//   Out of range positions are saturated to the edge of the range. Shapes with axis-aligned edges (rectangles, text, images) are unaffected as the edge is outside
+//   of the display, but the visible part of other shapes crossing it is distorted (e.g. a long diagonal line going 5000 pixels off-screen to the left).
+// - uv: unsigned normalized 16-bit, 0..65535 maps to 0.0f..1.0f. Out of range values are clamped: a texture can't be repeated using UV > 1.0f
+//   (e.g. AddImage() with uv_max = ImVec2(4.0f, 4.0f) with a GL_REPEAT sampler stretches the edge texels instead). Submit one quad per repetition instead.
+// - Fields convert from/to float and ImVec2 on access, so code reading or writing vertices is the same with both layouts.
+//   Each conversion rounds and clamps: writing vertices takes ~2x the CPU time of the default layout (see misc/bench/imgui_draw_bench.cpp).
+//   Only worth it when vertex upload bandwidth is the bottleneck.
+// - Your renderer needs to scale positions by 1.0f / (1 << IM_DRAWVERT_POS_FRAC_BITS) and offset them by IM_DRAWVERT_POS_ORIGIN (e.g. in the projection matrix),
+//   and declare UV as normalized unsigned shorts.
+#ifndef IM_DRAWVERT_POS_FRAC_BITS
+#define IM_DRAWVERT_POS_FRAC_BITS   3
+#endif
+#ifndef IM_DRAWVERT_POS_ORIGIN
+#define IM_DRAWVERT_POS_ORIGIN      2048.0f     // Center of the representable range, in pixels
+#endif
+struct ImDrawVertPosComponent
+{
+    ImS16   Value;
+    operator float() const                          { return Value * (1.0f / (1 << IM_DRAWVERT_POS_FRAC_BITS)) + IM_DRAWVERT_POS_ORIGIN; }
+    ImDrawVertPosComponent& operator=(float f)      { f = f * (1 << IM_DRAWVERT_POS_FRAC_BITS) + (32768.5f - IM_DRAWVERT_POS_ORIGIN * (1 << IM_DRAWVERT_POS_FRAC_BITS)); f = f > 0.0f ? f : 0.0f; f = f < 65535.0f ? f : 65535.0f; Value = (ImS16)((int)f - 32768); return *this; } // Round to nearest (half up), saturate
+    ImDrawVertPosComponent& operator+=(float f)     { return *this = (float)*this + f; }
+    ImDrawVertPosComponent& operator-=(float f)     { return *this = (float)*this - f; }
+};
+struct ImDrawVertUVComponent
+{
+    ImU16   Value;
+    operator float() const                          { return Value * (1.0f / 65535.0f); }
+    ImDrawVertUVComponent& operator=(float f)       { f = f * 65535.0f + 0.5f; f = f > 0.0f ? f : 0.0f; f = f < 65535.0f ? f : 65535.0f; Value = (ImU16)(int)f; return *this; }
+};
+struct ImDrawVertPos
+{
+    ImDrawVertPosComponent x, y;
+    operator ImVec2() const                         { return ImVec2(x, y); }
+    ImDrawVertPos& operator=(const ImVec2& v)       { x = v.x; y = v.y; return *this; }
+};
+struct ImDrawVertUV
+{
+    ImDrawVertUVComponent x, y;
+    operator ImVec2() const                         { return ImVec2(x, y); }
+    ImDrawVertUV& operator=(const ImVec2& v)        { x = v.x; y = v.y; return *this; }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos   pos;
+    ImDrawVertUV    uv;
+    ImU32           col;
+};
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
@@ -3237,6 +3333,8 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowSdfText            = 1 << 4,  // Can emit ImDrawCallback_BeginSdfText/ImDrawCallback_EndSdfText. Set when 'ImGuiBackendFlags_RendererHasSdfText' is enabled.
+    ImDrawListFlags_AllowLcdText            = 1 << 5,  // Can emit ImDrawCallback_BeginLcdText/ImDrawCallback_EndLcdText. Set when 'ImGuiBackendFlags_RendererHasLcdText' is enabled.
 };
 
 // Draw command list
@@ -3397,6 +3495,10 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTexture();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _BeginSdfText();
+    IMGUI_API void  _EndSdfText();
+    IMGUI_API void  _BeginLcdText();
+    IMGUI_API void  _EndLcdText();
     IMGUI_API void  _SetTexture(ImTextureRef tex_ref);
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
@@ -3549,6 +3651,7 @@ struct ImFontConfig
     ImFont*         DstFont;                // Target font (as we merging fonts, multiple ImFontConfig may target the same font)
     const ImFontLoader* FontLoader;         // Custom font backend for this source (default source is the one stored in ImFontAtlas)
     void*           FontLoaderData;         // Font loader opaque storage (per font config)
+    ImGuiID         FontDataHash;           // Hash of FontData[], computed when needed by the glyph cache (0 if not computed yet)
 
     IMGUI_API ImFontConfig();
 };
@@ -3560,10 +3663,11 @@ struct ImFontGlyph
     unsigned int    Colored : 1;        // Flag to indicate glyph is colored and should generally ignore tinting (make it usable with no shift on little-endian as this is used in loops)
     unsigned int    Visible : 1;        // Flag to indicate glyph has no visible pixels (e.g. space). Allow early out when rendering.
     unsigned int    SourceIdx : 4;      // Index of source in parent font
-    unsigned int    Codepoint : 26;     // 0x0000..0x10FFFF
+    unsigned int    Codepoint : 21;     // 0x0000..0x10FFFF
+    unsigned int    PageIndex : 5;      // [Internal] Texture page (see ImFontAtlas::TexPageSize). 0 when glyph is in ImFontAtlas->TexRef.
     float           AdvanceX;           // Horizontal distance to advance cursor/layout position.
     float           X0, Y0, X1, Y1;     // Glyph corners. Offsets from current cursor/layout position.
-    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef. Cached equivalent of calling GetCustomRect() with PackId.
+    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef (or texture page). Cached equivalent of calling GetCustomRect() with PackId.
     int             PackId;             // [Internal] ImFontAtlasRectId value (FIXME: Cold data, could be moved elsewhere?)
 
     ImFontGlyph()   { memset(this, 0, sizeof(*this)); PackId = -1; }
@@ -3609,6 +3713,7 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_UseTextSizeCache   = 1 << 3,   // Cache results of ImFont::CalcTextSizeA() (used by CalcTextSize()) for short strings measured repeatedly, without wrapping. Worth it for non-Latin text (e.g. ~25% faster on Cyrillic labels) and strings up to 7 bytes (e.g. ~30% faster on " 1234 "). Longer ASCII text is measured about as fast as it is hashed.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3627,7 +3732,7 @@ enum ImFontAtlasFlags_
 // - If you pass a 'glyph_ranges' array to AddFont*** functions, you need to make sure that your array persist up until the
 //   atlas is build (when calling GetTexData*** or Build()). We only copy the pointer, not the data.
 // - Important: By default, AddFontFromMemoryTTF() takes ownership of the data. Even though we are not writing to it, we will free the pointer on destruction.
-//   You can set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed,
+//   You can set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed, or use AddFontFromMemoryStaticTTF().
 // - Even though many functions are suffixed with "TTF", OTF data is supported just as well.
 // - This is an old API and it is currently awkward for those and various other reasons! We will address them in the future!
 struct ImFontAtlas
@@ -3638,6 +3743,7 @@ struct ImFontAtlas
     IMGUI_API ImFont*           AddFontDefault(const ImFontConfig* font_cfg = NULL);
     IMGUI_API ImFont*           AddFontFromFileTTF(const char* filename, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);
     IMGUI_API ImFont*           AddFontFromMemoryTTF(void* font_data, int font_data_size, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // Note: Transfer ownership of 'ttf_data' to ImFontAtlas! Will be deleted after destruction of the atlas. Set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed.
+    IMGUI_API ImFont*           AddFontFromMemoryStaticTTF(const void* font_data, int font_data_size, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);           // 'font_data' still owned by caller and used in place without copy: must persist for the lifetime of the atlas. e.g. array from binary_to_compressed_c.cpp with -nocompress.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_data_size, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedBase85TTF(const char* compressed_font_data_base85, float size_pixels = 0.0f, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);              // 'compressed_font_data_base85' still owned by caller. Compress with binary_to_compressed_c.cpp with -base85 parameter.
     IMGUI_API void              RemoveFont(ImFont* font);
@@ -3714,6 +3820,32 @@ struct ImFontAtlas
     IMGUI_API void              RemoveCustomRect(ImFontAtlasRectId id);                             // Unregister a rectangle. Existing pixels will stay in texture until resized / garbage collected.
     IMGUI_API bool              GetCustomRect(ImFontAtlasRectId id, ImFontAtlasRect* out_r) const;  // Get rectangle coordinates for current texture. Valid immediately, never store this (read above)!
 
+    //-------------------------------------------
+    // [EXPERIMENTAL] Asynchronous Glyph Rasterization
+    //-------------------------------------------
+
+    // - Set GlyphJobDispatchFunc to rasterize new glyphs on your own threads, instead of stalling the frame which first uses them (e.g. opening a CJK text file).
+    // - New glyphs are added right away with their final advance and size, so layout doesn't change, but they are not rendered until rasterized.
+    // - Your function needs to arrange for RunGlyphJob() to be called exactly once per job, on any thread. Results are copied into the texture by the next NewFrame().
+    // - Removing a font, clearing or destroying the atlas waits for jobs of the affected fonts: keep your threads running until then.
+    // - Only supported by the stb_truetype loader, and with a backend supporting ImGuiBackendFlags_RendererHasTextures. Other glyphs are rasterized immediately.
+    // - Without ImGuiBackendFlags_RendererHasTextures, Build() preloading all glyph ranges also uses your function and waits for jobs: texture is identical, but built faster.
+    // - Your memory allocator (see SetAllocatorFunctions()) needs to be thread-safe.
+    IMGUI_API static void       RunGlyphJob(ImFontAtlasGlyphJob* job);                              // Rasterize glyph. Only accesses job and font data, never the atlas.
+
+    //-------------------------------------------
+    // [EXPERIMENTAL] Persistent Glyph Cache
+    //-------------------------------------------
+
+    // - Save rasterized glyphs (bitmaps + metrics) on exit and load them on the next startup, so baking a font size doesn't need to call the rasterizer for glyphs it had already used.
+    // - Glyphs are stored per baked font, identified by a hash of the font data, font config, size, density, font loader and loader flags. Changing any of them ignores the stored glyphs.
+    // - Load before the first NewFrame(), or at least before the baked fonts you need are created. Saving includes every live baked font + previously loaded entries that weren't used.
+    // - The file is tied to the Dear ImGui version and to the machine's endianness. Invalid or outdated files are ignored.
+    IMGUI_API bool              LoadGlyphCacheFromDisk(const char* filename);                       // Return false if the file couldn't be read or is not a valid glyph cache.
+    IMGUI_API bool              LoadGlyphCacheFromMemory(const void* data, size_t data_size);       // Data is copied.
+    IMGUI_API bool              SaveGlyphCacheToDisk(const char* filename);
+    IMGUI_API const void*       SaveGlyphCacheToMemory(size_t* out_size);                           // Return a buffer owned by the atlas, valid until the next call to a glyph cache function.
+
     //-------------------------------------------
     // Members
     //-------------------------------------------
@@ -3726,7 +3858,10 @@ struct ImFontAtlas
     int                         TexMinHeight;       // Minimum desired texture height. Must be a power of two. Default to 128.
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
+    int                         TexDefragMaxPixels; // Maximum number of glyph pixels moved per frame to compact texture after glyphs are discarded. Default to 64*64. Set to 0 to disable. Only moved glyphs are uploaded.
+    int                         TexPageSize;        // Size of texture pages. Default to 0 (disabled). e.g. 1024: glyphs which don't fit are packed into additional 1024x1024 textures, instead of growing and repacking current texture. Must be a power of two, no larger than TexMaxWidth/TexMaxHeight. Glyphs larger than a page are not rendered. Requires ImGuiBackendFlags_RendererHasTextures. Set before building atlas.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    void                        (*GlyphJobDispatchFunc)(ImFontAtlas* atlas, ImFontAtlasGlyphJob* job); // [EXPERIMENTAL] Queue glyph rasterization to your threads. See RunGlyphJob().
 
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
@@ -3739,9 +3874,11 @@ struct ImFontAtlas
     ImTextureData*              TexData;            // Latest texture.
 
     // [Internal]
-    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back(). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
+    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1, more with TexPageSize). TexData is always == TexList.back(). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
     bool                        Locked;             // Marked as locked during ImGui::NewFrame()..EndFrame() scope if TexUpdates are not supported. Any attempt to modify the atlas will assert.
     bool                        RendererHasTextures;// Copy of (BackendFlags & ImGuiBackendFlags_RendererHasTextures) from supporting context.
+    bool                        RendererHasSdfText; // Copy of (BackendFlags & ImGuiBackendFlags_RendererHasSdfText) from owner context.
+    bool                        RendererHasLcdText; // Copy of (BackendFlags & ImGuiBackendFlags_RendererHasLcdText) from owner context.
     bool                        TexIsBuilt;         // Set when texture was built matching current font input. Mostly useful for legacy IsBuilt() call.
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format or conversion process.
     ImVec2                      TexUvScale;         // = (1.0f/TexData->TexWidth, 1.0f/TexData->TexHeight). May change as new texture gets created.
@@ -3753,6 +3890,7 @@ struct ImFontAtlas
     int                         FontNextUniqueID;   // Next value to be stored in ImFont->FontID
     ImVector<ImDrawListSharedData*> DrawListSharedDatas; // List of users for this atlas. Typically one per Dear ImGui context.
     ImFontAtlasBuilder*         Builder;            // Opaque interface to our data that doesn't need to be public and may be discarded when rebuilding.
+    ImFontAtlasGlyphCache*      GlyphCache;         // Persistent glyph cache loaded with LoadGlyphCacheFromDisk(). Not discarded when rebuilding.
     const ImFontLoader*         FontLoader;         // Font loader opaque interface (default to use FreeType when IMGUI_ENABLE_FREETYPE is defined, otherwise default to use stb_truetype). Use SetFontLoader() to change this at runtime.
     const char*                 FontLoaderName;     // Font loader name (for display e.g. in About box) == FontLoader->Name
     void*                       FontLoaderData;     // Font backend opaque storage
@@ -3792,16 +3930,23 @@ struct ImFontBaked
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out // All glyphs.
     int                         FallbackGlyphIndex; // 4     // out // Index of FontFallbackChar
 
+    // [Internal] Members: Hot 3/5 KB (for Latin-1 text, e.g. source code)
+    float                       Latin1AdvanceX[256];// 1024  // out // Dense. Same as IndexAdvanceX[] for U+0000..U+00FF, without bounds check. -1.0f when not loaded.
+    ImFontGlyph*                Latin1Glyphs[256];  // 1-2K  // out // Dense. Resolved glyph for U+0000..U+00FF (fallback glyph when missing from font). NULL when not loaded. Updated when Glyphs[] grows.
+
     // [Internal] Members: Cold
     float                       Ascent, Descent;    // 4+4   // out // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize] (unscaled)
     unsigned int                MetricsTotalSurface:26;// 3  // out // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     unsigned int                WantDestroy:1;         // 0  //     // Queued for destroy
     unsigned int                LoadNoFallback:1;      // 0  //     // Disable loading fallback in lower-level calls.
     unsigned int                LoadNoRenderOnLayout:1;// 0  //     // Enable a two-steps mode where CalcTextSize() calls will load AdvanceX *without* rendering/packing glyphs. Only advantagous if you know that the glyph is unlikely to actually be rendered, otherwise it is slower because we'd do one query on the first CalcTextSize and one query on the first Draw.
+    unsigned int                IsSdf:1;               // 0  //     // Glyphs are signed distance fields, see ImFontFlags_SDF.
+    unsigned int                IsLcd:1;               // 0  //     // Glyphs store per-subpixel coverage in RGB, see ImFontFlags_LCD.
     int                         LastUsedFrame;         // 4  //     // Record of that time this was bounds
     ImGuiID                     BakedId;            // 4     //     // Unique ID for this baked storage
     ImFont*                     OwnerFont;          // 4-8   // in  // Parent font
     void*                       FontLoaderDatas;    // 4-8   //     // Font loader opaque storage (per baked font * sources): single contiguous buffer allocated by imgui, passed to loader.
+    ImFontBakedTextSizeCache*   TextSizeCache;      // 4-8   //     // Allocated on first use when ImFontAtlasFlags_UseTextSizeCache is set.
 
     // Functions
     IMGUI_API ImFontBaked();
@@ -3820,6 +3965,8 @@ enum ImFontFlags_
     ImFontFlags_NoLoadError             = 1 << 1,   // Disable throwing an error/assert when calling AddFontXXX() with missing file/data. Calling code is expected to check AddFontXXX() return value.
     ImFontFlags_NoLoadGlyphs            = 1 << 2,   // [Internal] Disable loading new glyphs.
     ImFontFlags_LockBakedSizes          = 1 << 3,   // [Internal] Disable loading new baked sizes, disable garbage collecting current ones. e.g. if you want to lock a font to a single size. Important: if you use this to preload given sizes, consider the possibility of multiple font density used on Retina display.
+    ImFontFlags_SDF                     = 1 << 4,   // [EXPERIMENTAL] Bake glyphs once as signed distance fields, and scale them at render time: changing font size doesn't rasterize glyphs again. Requires ImGuiBackendFlags_RendererHasSdfText and the stb_truetype loader, otherwise ignored.
+    ImFontFlags_LCD                     = 1 << 5,   // [EXPERIMENTAL] Rasterize glyphs at 3x horizontal resolution, storing coverage of each R/G/B subpixel: sharper small text on LCD monitors with horizontal RGB subpixel layout. Same vertex count as regular text. Requires ImGuiBackendFlags_RendererHasLcdText and ImTextureFormat_RGBA32 atlas, otherwise ignored. Ignored when combined with ImFontFlags_SDF. Limitations: color glyphs (e.g. emojis) are drawn in text color; text added to a draw list without ImDrawListFlags_AllowLcdText shows color fringes.
 };
 
 // Font runtime data and rendering
@@ -41,6 +41,25 @@ Index of this file:
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // _InterlockedExchange, _InterlockedOr, _mm_pause, __yield
+#endif
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef __MINGW32__
+#include <Windows.h>    // SwitchToThread, Sleep
+#else
+#include <windows.h>
+#endif
+#elif !defined(_WIN32)
+#include <sched.h>      // sched_yield
+#include <time.h>       // nanosleep
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -137,8 +156,29 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+// Glyphs rasterized on other threads set stbtt_fontinfo::userdata (see ImGui_ImplStbTrueType_RasterizeGlyph()).
+// Their allocations bypass ImGui::MemAlloc()/MemFree(), which update debug counters of the current context.
+static void* ImGui_ImplStbTrueType_MemAlloc(size_t size, void* user_data)
+{
+    if (user_data == NULL)
+        return IM_ALLOC(size);
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* alloc_user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data);
+    return alloc_func(size, alloc_user_data);
+}
+static void ImGui_ImplStbTrueType_MemFree(void* ptr, void* user_data)
+{
+    if (user_data == NULL)
+    {
+        IM_FREE(ptr);
+        return;
+    }
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* alloc_user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data);
+    free_func(ptr, alloc_user_data);
+}
+#define STBTT_malloc(x,u)   ImGui_ImplStbTrueType_MemAlloc(x,u)
+#define STBTT_free(x,u)     ImGui_ImplStbTrueType_MemFree(x,u)
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -642,6 +682,46 @@ void ImDrawList::_OnChangedVtxOffset()
     curr_cmd->VtxOffset = _CmdHeader.VtxOffset;
 }
 
+// Reopen previous text command if nothing was submitted since it ended (e.g. consecutive text calls), to avoid two callbacks per text call.
+// [..., text, end_callback, empty current command] --> [..., text]
+static bool ImDrawList_ReopenTextCallbackBlock(ImDrawList* draw_list, ImDrawCallback end_callback)
+{
+    ImVector<ImDrawCmd>& cmd_buffer = draw_list->CmdBuffer;
+    if (cmd_buffer.Size < 3)
+        return false;
+    ImDrawCmd* curr_cmd = &cmd_buffer.Data[cmd_buffer.Size - 1];
+    ImDrawCmd* end_cmd = curr_cmd - 1;
+    ImDrawCmd* text_cmd = curr_cmd - 2;
+    if (curr_cmd->ElemCount != 0 || curr_cmd->UserCallback != NULL || end_cmd->UserCallback != end_callback || text_cmd->UserCallback != NULL || ImDrawCmd_HeaderCompare(text_cmd, &draw_list->_CmdHeader) != 0)
+        return false;
+    cmd_buffer.Size -= 2;
+    return true;
+}
+
+// Called around glyphs of a font using ImFontFlags_SDF (see ImDrawCallback_BeginSdfText)
+void ImDrawList::_BeginSdfText()
+{
+    if (!ImDrawList_ReopenTextCallbackBlock(this, ImDrawCallback_EndSdfText))
+        AddCallback(ImDrawCallback_BeginSdfText, NULL);
+}
+
+void ImDrawList::_EndSdfText()
+{
+    AddCallback(ImDrawCallback_EndSdfText, NULL);
+}
+
+// Called around glyphs of a font using ImFontFlags_LCD (see ImDrawCallback_BeginLcdText)
+void ImDrawList::_BeginLcdText()
+{
+    if (!ImDrawList_ReopenTextCallbackBlock(this, ImDrawCallback_EndLcdText))
+        AddCallback(ImDrawCallback_BeginLcdText, NULL);
+}
+
+void ImDrawList::_EndLcdText()
+{
+    AddCallback(ImDrawCallback_EndLcdText, NULL);
+}
+
 int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 {
     // Automatic segment count
@@ -801,6 +881,115 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Tessellation kernels for AddPolyline(), AddConvexPolyFilled() and AddConcavePolyFilled().
+// - The SIMD paths process 4 (SSE) or 8 (AVX2) points per iteration, keeping ImVec2 interleaved in registers (x0 y0 x1 y1) to avoid transposing.
+// - They perform the same operations in the same order as IM_NORMALIZE2F_OVER_ZERO()/IM_FIXNORMAL2F(), so output is bit-identical
+//   to the scalar path (unless the compiler contracts the scalar path into FMA instructions, in which case it is within 1 ulp).
+#ifdef IMGUI_ENABLE_SSE
+// (x0 y0 x1 y1) -> (x0*x0+y0*y0) twice, (x1*x1+y1*y1) twice
+static inline __m128 ImDot2x2(__m128 v) { __m128 sq = _mm_mul_ps(v, v); return _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1))); }
+static inline __m128 ImSelect(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+#endif
+#ifdef IMGUI_ENABLE_AVX2
+static inline __m256 ImDot2x4(__m256 v) { __m256 sq = _mm256_mul_ps(v, v); return _mm256_add_ps(sq, _mm256_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1))); }
+#endif
+
+// Normal of each segment [i, i+1] for i in [0, count). When count == points_count the last segment wraps to points[0].
+static void ImDrawListBuildSegmentNormals(const ImVec2* points, int points_count, int count, ImVec2* out_normals)
+{
+    int i = 0;
+#ifdef IMGUI_ENABLE_SSE
+    const int count_no_wrap = ImMin(count, points_count - 1); // SIMD paths load points[i + 1] directly: the wrapping segment is left to the scalar loop
+#endif
+#ifdef IMGUI_ENABLE_AVX2
+    {
+        const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f), neg_y = _mm256_set_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+        for (; i + 8 <= count_no_wrap; i += 8)
+            for (int k = i; k < i + 8; k += 4)
+            {
+                const float* p = &points[k].x;
+                __m256 d = _mm256_sub_ps(_mm256_loadu_ps(p + 2), _mm256_loadu_ps(p));
+                __m256 d2 = ImDot2x4(d);
+                __m256 inv_len = _mm256_blendv_ps(one, _mm256_rsqrt_ps(d2), _mm256_cmp_ps(d2, zero, _CMP_GT_OQ));
+                d = _mm256_mul_ps(d, inv_len);
+                _mm256_storeu_ps(&out_normals[k].x, _mm256_xor_ps(_mm256_permute_ps(d, _MM_SHUFFLE(2, 3, 0, 1)), neg_y)); // (dy, -dx)
+            }
+    }
+#endif
+#ifdef IMGUI_ENABLE_SSE
+    {
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), neg_y = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+        for (; i + 4 <= count_no_wrap; i += 4)
+            for (int k = i; k < i + 4; k += 2)
+            {
+                const float* p = &points[k].x;
+                __m128 d = _mm_sub_ps(_mm_loadu_ps(p + 2), _mm_loadu_ps(p));
+                __m128 d2 = ImDot2x2(d);
+                d = _mm_mul_ps(d, ImSelect(_mm_cmpgt_ps(d2, zero), _mm_rsqrt_ps(d2), one));
+                _mm_storeu_ps(&out_normals[k].x, _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)), neg_y)); // (dy, -dx)
+            }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        const int i2 = (i + 1) == points_count ? 0 : i + 1;
+        float dx = points[i2].x - points[i].x;
+        float dy = points[i2].y - points[i].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i].x = dy;
+        out_normals[i].y = -dx;
+    }
+}
+
+// Averaged normal at each point, from the normals of the segments before and after it. The segment before points[0] is normals[points_count - 1].
+static void ImDrawListBuildMiters(const ImVec2* normals, int points_count, ImVec2* out_miters)
+{
+    {
+        float dm_x = (normals[points_count - 1].x + normals[0].x) * 0.5f;
+        float dm_y = (normals[points_count - 1].y + normals[0].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_miters[0].x = dm_x;
+        out_miters[0].y = dm_y;
+    }
+    int i = 1;
+#ifdef IMGUI_ENABLE_AVX2
+    {
+        const __m256 half = _mm256_set1_ps(0.5f), one = _mm256_set1_ps(1.0f), min_d2 = _mm256_set1_ps(0.000001f), max_inv_len2 = _mm256_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+        for (; i + 8 <= points_count; i += 8)
+            for (int k = i; k < i + 8; k += 4)
+            {
+                __m256 dm = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&normals[k - 1].x), _mm256_loadu_ps(&normals[k].x)), half);
+                __m256 d2 = ImDot2x4(dm);
+                __m256 inv_len2 = _mm256_min_ps(_mm256_div_ps(one, d2), max_inv_len2);
+                dm = _mm256_mul_ps(dm, _mm256_blendv_ps(one, inv_len2, _mm256_cmp_ps(d2, min_d2, _CMP_GT_OQ)));
+                _mm256_storeu_ps(&out_miters[k].x, dm);
+            }
+    }
+#endif
+#ifdef IMGUI_ENABLE_SSE
+    {
+        const __m128 half = _mm_set1_ps(0.5f), one = _mm_set1_ps(1.0f), min_d2 = _mm_set1_ps(0.000001f), max_inv_len2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+        for (; i + 4 <= points_count; i += 4)
+            for (int k = i; k < i + 4; k += 2)
+            {
+                __m128 dm = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&normals[k - 1].x), _mm_loadu_ps(&normals[k].x)), half);
+                __m128 d2 = ImDot2x2(dm);
+                __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), max_inv_len2);
+                dm = _mm_mul_ps(dm, ImSelect(_mm_cmpgt_ps(d2, min_d2), inv_len2, one));
+                _mm_storeu_ps(&out_miters[k].x, dm);
+            }
+    }
+#endif
+    for (; i < points_count; i++)
+    {
+        float dm_x = (normals[i - 1].x + normals[i].x) * 0.5f;
+        float dm_y = (normals[i - 1].y + normals[i].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_miters[i].x = dm_x;
+        out_miters[i].y = dm_y;
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -837,23 +1026,21 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        // The first <points_count> items are normals at each line segment, then after that there are <points_count> averaged normals (miters) at each line point
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
+        ImVec2* temp_miters = temp_normals + points_count;
 
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        // Calculate normals (tangents) for each line segment, then average them at each point
+        ImDrawListBuildSegmentNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        ImDrawListBuildMiters(temp_normals, points_count, temp_miters);
+
+        // If line is not closed, the first point needs to be generated differently as there are no normals to blend
+        // (the last point blends its segment normal with itself, as set above)
+        if (!closed)
+            temp_miters[0] = temp_normals[0];
 
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
@@ -868,38 +1055,12 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertices for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -916,11 +1077,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                     _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
                     _IdxWritePtr += 12;
                 }
-
                 idx1 = idx2;
             }
 
-            // Add vertices for each point on the line
+            // Add vertices for each point on the line, offset along the miters to the outer edges of the AA area
             if (use_texture)
             {
                 // If we're using textures we only need to emit the left/right edge vertices
@@ -937,8 +1097,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    const float dm_x = temp_miters[i].x * half_draw_size;
+                    const float dm_y = temp_miters[i].y * half_draw_size;
+                    _VtxWritePtr[0].pos.x = points[i].x + dm_x; _VtxWritePtr[0].pos.y = points[i].y + dm_y; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
+                    _VtxWritePtr[1].pos.x = points[i].x - dm_x; _VtxWritePtr[1].pos.y = points[i].y - dm_y; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
                     _VtxWritePtr += 2;
                 }
             }
@@ -947,9 +1109,11 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 // If we're not using a texture, we need the center vertex as well
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    const float dm_x = temp_miters[i].x * half_draw_size;
+                    const float dm_y = temp_miters[i].y * half_draw_size;
+                    _VtxWritePtr[0].pos = points[i];                                                    _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
+                    _VtxWritePtr[1].pos.x = points[i].x + dm_x; _VtxWritePtr[1].pos.y = points[i].y + dm_y; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
+                    _VtxWritePtr[2].pos.x = points[i].x - dm_x; _VtxWritePtr[2].pos.y = points[i].y - dm_y; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
                     _VtxWritePtr += 3;
                 }
             }
@@ -958,51 +1122,14 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         {
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+            const float half_outer_thickness = half_inner_thickness + AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
                 _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
@@ -1010,17 +1137,20 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
                 _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
                 _IdxWritePtr += 18;
-
                 idx1 = idx2;
             }
 
             // Add vertices
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                const float dm_out_x = temp_miters[i].x * half_outer_thickness;
+                const float dm_out_y = temp_miters[i].y * half_outer_thickness;
+                const float dm_in_x = temp_miters[i].x * half_inner_thickness;
+                const float dm_in_y = temp_miters[i].y * half_inner_thickness;
+                _VtxWritePtr[0].pos.x = points[i].x + dm_out_x; _VtxWritePtr[0].pos.y = points[i].y + dm_out_y; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
+                _VtxWritePtr[1].pos.x = points[i].x + dm_in_x;  _VtxWritePtr[1].pos.y = points[i].y + dm_in_y;  _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos.x = points[i].x - dm_in_x;  _VtxWritePtr[2].pos.y = points[i].y - dm_in_y;  _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos.x = points[i].x - dm_out_x; _VtxWritePtr[3].pos.y = points[i].y - dm_out_y; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
                 _VtxWritePtr += 4;
             }
         }
@@ -1089,16 +1219,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         // Compute normals
         _Data->TempBuffer.reserve_discard(points_count);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImDrawListBuildSegmentNormals(points, points_count, points_count, temp_normals);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
@@ -2048,16 +2169,7 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         // Compute normals
         _Data->TempBuffer.reserve_discard(points_count);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImDrawListBuildSegmentNormals(points, points_count, points_count, temp_normals);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
@@ -2518,6 +2630,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlas::AddFontDefault()
 // - ImFontAtlas::AddFontFromFileTTF()
 // - ImFontAtlas::AddFontFromMemoryTTF()
+// - ImFontAtlas::AddFontFromMemoryStaticTTF()
 // - ImFontAtlas::AddFontFromMemoryCompressedTTF()
 // - ImFontAtlas::AddFontFromMemoryCompressedBase85TTF()
 // - ImFontAtlas::RemoveFont()
@@ -2558,17 +2671,25 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildRepackTexture()
 // - ImFontAtlasBuildGrowTexture()
 // - ImFontAtlasBuildRepackOrGrowTexture()
+// - ImFontAtlasTextureAddPage()
 // - ImFontAtlasBuildGetTextureSizeEstimate()
 // - ImFontAtlasBuildCompactTexture()
 // - ImFontAtlasBuildInit()
 // - ImFontAtlasBuildDestroy()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasPackInit()
+// - ImFontAtlasPackSetCurrentPage()
+// - ImFontAtlasPackSkylineXXX()
+// - ImFontAtlasPackFindSpace()
+// - ImFontAtlasPackSkylineLower()
+// - ImFontAtlasPackReleaseSpace()
+// - ImFontAtlasTextureDefrag()
 // - ImFontAtlasPackAllocRectEntry()
 // - ImFontAtlasPackReuseRectEntry()
 // - ImFontAtlasPackDiscardRect()
 // - ImFontAtlasPackAddRect()
 // - ImFontAtlasPackGetRect()
+// - ImFontAtlasPackGetRectPage()
 //-----------------------------------------------------------------------------
 // - ImFontBaked_BuildGrowIndex()
 // - ImFontBaked_BuildLoadGlyph()
@@ -2642,11 +2763,14 @@ ImFontAtlas::ImFontAtlas()
     TexMinHeight = 128;
     TexMaxWidth = 8192;
     TexMaxHeight = 8192;
+    TexDefragMaxPixels = 64 * 64;
+    TexPageSize = 0;
     TexRef._TexID = ImTextureID_Invalid;
     RendererHasTextures = false; // Assumed false by default, as apps can call e.g Atlas::Build() after backend init and before ImGui can update.
     TexNextUniqueID = 1;
     FontNextUniqueID = 1;
     Builder = NULL;
+    GlyphCache = NULL;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -2657,6 +2781,8 @@ ImFontAtlas::~ImFontAtlas()
     ClearTexData();
     TexList.clear_delete();
     TexData = NULL;
+    if (GlyphCache != NULL)
+        IM_DELETE(GlyphCache);
 }
 
 // If you call this mid-frame, you would need to add new font and bind them!
@@ -2842,6 +2968,14 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
             tex_n--;
         }
     }
+
+    // Copy glyphs rasterized on other threads (after updating texture status, so they are uploaded along with this frame's other updates)
+    if (builder->GlyphJobs.Size > 0)
+        ImFontAtlasBuildUpdateGlyphJobs(atlas);
+
+    // Reclaim space left by discarded glyphs
+    if (atlas->RendererHasTextures && atlas->TexDefragMaxPixels > 0)
+        ImFontAtlasTextureDefrag(atlas, atlas->TexDefragMaxPixels);
 }
 
 void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
@@ -2879,6 +3013,35 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
     }
 }
 
+// Convert subpixel coverage (3 horizontal samples per pixel, in R/G/B order) to RGBA32 pixels for fonts using ImFontFlags_LCD.
+// Output is 'w' pixels wide, including IM_FONTBAKED_LCD_PADDING pixels on each side: source has (w - IM_FONTBAKED_LCD_PADDING * 2) * 3 samples per row.
+// Samples go through a 5-tap FIR filter (same weights as FreeType's FT_LCD_FILTER_DEFAULT), trading a bit of sharpness for much less color fringing.
+void ImFontAtlasTextureBlockConvertLcd(const unsigned char* src_subpixels, int src_pitch, unsigned char* dst_pixels, int dst_pitch, int w, int h)
+{
+    static const unsigned int filter[5] = { 0x08, 0x4D, 0x56, 0x4D, 0x08 }; // Sum to 256
+    const int src_w = (w - IM_FONTBAKED_LCD_PADDING * 2) * 3;
+    IM_ASSERT(src_w > 0 && IM_FONTBAKED_LCD_PADDING * 3 >= IM_ARRAYSIZE(filter) / 2);
+    for (int ny = 0; ny < h; ny++, src_subpixels += src_pitch, dst_pixels += dst_pitch)
+    {
+        const ImU8* src_p = (const ImU8*)src_subpixels;
+        ImU32* dst_p = (ImU32*)(void*)dst_pixels;
+        for (int nx = 0; nx < w; nx++)
+        {
+            unsigned int rgb[3];
+            for (int channel = 0; channel < 3; channel++)
+            {
+                const int sx = (nx - IM_FONTBAKED_LCD_PADDING) * 3 + channel;
+                unsigned int sum = 0;
+                for (int tap = 0; tap < 5; tap++)
+                    if (sx + tap - 2 >= 0 && sx + tap - 2 < src_w)
+                        sum += src_p[sx + tap - 2] * filter[tap];
+                rgb[channel] = ImMin(sum >> 8, 255u);
+            }
+            *dst_p++ = IM_COL32(rgb[0], rgb[1], rgb[2], (rgb[0] + rgb[1] + rgb[2]) / 3);
+        }
+    }
+}
+
 // Source buffer may be written to (used for in-place mods).
 // Post-process hooks may eventually be added here.
 void ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data)
@@ -2922,7 +3085,7 @@ void ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data
     }
 }
 
-// Fill with single color. We don't use this directly but it is convenient for anyone working on uploading custom rects.
+// Fill with single color. Used to clear discarded rectangles, also convenient for anyone working on uploading custom rects.
 void ImFontAtlasTextureBlockFill(ImTextureData* dst_tex, int dst_x, int dst_y, int w, int h, ImU32 col)
 {
     if (dst_tex->Format == ImTextureFormat_Alpha8)
@@ -2976,10 +3139,13 @@ void ImFontAtlasTextureBlockQueueUpload(ImFontAtlas* atlas, ImTextureData* tex,
     atlas->TexIsBuilt = false;
 
     // No need to queue if status is == ImTextureStatus_WantCreate
+    // Skip requests contained in previous one (e.g. glyph pixels written after ImFontAtlasPackAddRect() queued the area)
     if (tex->Status == ImTextureStatus_OK || tex->Status == ImTextureStatus_WantUpdates)
     {
         tex->Status = ImTextureStatus_WantUpdates;
-        tex->Updates.push_back(req);
+        const ImTextureRect* last = tex->Updates.Size > 0 ? &tex->Updates.back() : NULL;
+        if (last == NULL || req.x < last->x || req.y < last->y || req.x + req.w > last->x + last->w || req.y + req.h > last->y + last->h)
+            tex->Updates.push_back(req);
     }
 }
 
@@ -3050,6 +3216,7 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
     // Add to list
     Sources.push_back(*font_cfg_in);
     ImFontConfig* font_cfg = &Sources.back();
+    font_cfg->FontDataHash = 0;
     if (font_cfg->DstFont == NULL)
         font_cfg->DstFont = font;
     font->Sources.push_back(font_cfg);
@@ -3105,7 +3272,7 @@ static void         Decode85(const unsigned char* src, unsigned char* dst)
     }
 }
 #ifndef IMGUI_DISABLE_DEFAULT_FONT
-static const char* GetDefaultCompressedFontDataTTF(int* out_size);
+static const void* GetDefaultFontDataTTF(int* out_size);
 #endif
 
 // Load embedded ProggyClean.ttf at size 13, disable oversampling
@@ -3126,9 +3293,9 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
     font_cfg.EllipsisChar = (ImWchar)0x0085;
     font_cfg.GlyphOffset.y += 1.0f * IM_TRUNC(font_cfg.SizePixels / 13.0f);  // Add +1 offset per 13 units
 
-    int ttf_compressed_size = 0;
-    const char* ttf_compressed = GetDefaultCompressedFontDataTTF(&ttf_compressed_size);
-    return AddFontFromMemoryCompressedTTF(ttf_compressed, ttf_compressed_size, font_cfg.SizePixels, &font_cfg);
+    int ttf_size = 0;
+    const void* ttf_data = GetDefaultFontDataTTF(&ttf_size);
+    return AddFontFromMemoryStaticTTF(ttf_data, ttf_size, font_cfg.SizePixels, &font_cfg);
 #else
     IM_ASSERT(0 && "AddFontDefault() disabled in this build.");
     IM_UNUSED(font_cfg_template);
@@ -3176,6 +3343,15 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* font_data, int font_data_size, f
     return AddFont(&font_cfg);
 }
 
+// Use data in place without copying nor taking ownership: data needs to persist for the whole lifetime of the atlas.
+ImFont* ImFontAtlas::AddFontFromMemoryStaticTTF(const void* font_data, int font_data_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
+{
+    ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
+    IM_ASSERT(font_cfg.FontData == NULL);
+    font_cfg.FontDataOwnedByAtlas = false;
+    return AddFontFromMemoryTTF((void*)font_data, font_data_size, size_pixels, &font_cfg, glyph_ranges); // Font loaders never write to FontData
+}
+
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
@@ -3261,17 +3437,16 @@ ImFontAtlasRectId ImFontAtlas::AddCustomRect(int width, int height, ImFontAtlasR
     if (Builder == NULL)
         ImFontAtlasBuildInit(this);
 
-    ImFontAtlasRectId r_id = ImFontAtlasPackAddRect(this, width, height);
+    ImFontAtlasRectId r_id = ImFontAtlasPackAddRect(this, width, height, NULL, true); // User expects pixels to be in TexData
     if (r_id == ImFontAtlasRectId_Invalid)
         return ImFontAtlasRectId_Invalid;
     if (out_r != NULL)
         GetCustomRect(r_id, out_r);
 
+    ImTextureRect* r = ImFontAtlasPackGetRect(this, r_id);
+    ImFontAtlasTextureBlockFill(TexData, r->x, r->y, r->w, r->h, IM_COL32_BLACK_TRANS); // Space may have been used by discarded rectangles
     if (RendererHasTextures)
-    {
-        ImTextureRect* r = ImFontAtlasPackGetRect(this, r_id);
         ImFontAtlasTextureBlockQueueUpload(this, TexData, r->x, r->y, r->w, r->h);
-    }
     return r_id;
 }
 
@@ -3307,10 +3482,11 @@ ImFontAtlasRectId ImFontAtlas::AddCustomRectFontGlyphForSize(ImFont* font, float
 
     ImFontBaked* baked = font->GetFontBaked(font_size);
 
-    ImFontAtlasRectId r_id = ImFontAtlasPackAddRect(this, width, height);
+    ImFontAtlasRectId r_id = ImFontAtlasPackAddRect(this, width, height, NULL, true); // User expects pixels to be in TexData
     if (r_id == ImFontAtlasRectId_Invalid)
         return ImFontAtlasRectId_Invalid;
     ImTextureRect* r = ImFontAtlasPackGetRect(this, r_id);
+    ImFontAtlasTextureBlockFill(TexData, r->x, r->y, r->w, r->h, IM_COL32_BLACK_TRANS); // Space may have been used by discarded rectangles
     if (RendererHasTextures)
         ImFontAtlasTextureBlockQueueUpload(this, TexData, r->x, r->y, r->w, r->h);
 
@@ -3426,9 +3602,13 @@ void ImFontAtlasBuildSetupFontLoader(ImFontAtlas* atlas, const ImFontLoader* fon
 
 // Preload all glyph ranges for legacy backends.
 // This may lead to multiple texture creation which might be a little slower than before.
+// When ImFontAtlas::GlyphJobDispatchFunc is set, glyphs are packed here in the same order but rasterized on your threads.
+// We wait for them before returning. Results are copied in the texture on this thread, so the output is identical.
 void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
 {
-    atlas->Builder->PreloadedAllGlyphsRanges = true;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->PreloadedAllGlyphsRanges = true;
+    builder->PreloadingGlyphs = true;
     for (ImFont* font : atlas->Fonts)
     {
         ImFontBaked* baked = font->GetFontBaked(font->LegacySize);
@@ -3442,8 +3622,13 @@ void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
             for (; ranges[0]; ranges += 2)
                 for (unsigned int c = ranges[0]; c <= ranges[1] && c <= IM_UNICODE_CODEPOINT_MAX; c++) //-V560
                     baked->FindGlyph((ImWchar)c);
+            if (builder->GlyphJobs.Size > 0)
+                ImFontAtlasBuildUpdateGlyphJobs(atlas); // Release memory of completed jobs
         }
     }
+    if (builder->GlyphJobs.Size > 0)
+        ImFontAtlasBuildFinishGlyphJobs(atlas);
+    builder->PreloadingGlyphs = false;
 }
 
 // FIXME: May make ImFont::Sources a ImSpan<> and move ownership to ImFontAtlas
@@ -3597,6 +3782,7 @@ bool ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font)
 // Keep source/input FontData
 void ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font)
 {
+    ImFontAtlasBuildWaitGlyphJobs(atlas, font);
     font->ClearOutputData();
     for (ImFontConfig* src : font->Sources)
     {
@@ -3658,6 +3844,8 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
         dot_glyph = baked->FindGlyphNoFallback((ImWchar)0xFF0E);
     if (dot_glyph == NULL)
         return NULL;
+    if (!dot_glyph->Visible && dot_glyph->PackId != ImFontAtlasRectId_Invalid)
+        ImFontAtlasBuildFlushGlyphJob(atlas, dot_glyph->PackId); // We need its pixels
     ImFontAtlasRectId dot_r_id = dot_glyph->PackId; // Deep copy to avoid invalidation of glyphs and rect pointers
     ImTextureRect* dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
     const int dot_spacing = 1;
@@ -3682,9 +3870,11 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
     // Copy to texture, post-process and queue update for backend
     // FIXME-NEWATLAS-V2: Dot glyph is already post-processed as this point, so this would damage it.
     dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* dot_tex = ImFontAtlasPackGetPageTexture(atlas, ImFontAtlasPackGetRectPage(atlas, dot_r_id));
+    ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, glyph->PageIndex);
+    ImFontAtlasTextureBlockFill(tex, r->x, r->y, r->w, r->h, IM_COL32_BLACK_TRANS); // Clear spacing between dots
     for (int n = 0; n < 3; n++)
-        ImFontAtlasTextureBlockCopy(tex, dot_r->x, dot_r->y, tex, r->x + (dot_r->w + dot_spacing) * n, r->y, dot_r->w, dot_r->h);
+        ImFontAtlasTextureBlockCopy(dot_tex, dot_r->x, dot_r->y, tex, r->x + (dot_r->w + dot_spacing) * n, r->y, dot_r->w, dot_r->h);
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
 
     return glyph;
@@ -3778,6 +3968,16 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_UNUSED(font);
     baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
     baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    if (baked->TextSizeCache != NULL)
+    {
+        IM_DELETE(baked->TextSizeCache);
+        baked->TextSizeCache = NULL;
+    }
+    if (c < IM_ARRAYSIZE(baked->Latin1Glyphs))
+    {
+        baked->Latin1Glyphs[c] = NULL;
+        baked->Latin1AdvanceX[c] = baked->FallbackAdvanceX;
+    }
 }
 
 ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
@@ -3789,6 +3989,8 @@ ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_si
     baked->BakedId = baked_id;
     baked->OwnerFont = font;
     baked->LastUsedFrame = atlas->Builder->FrameCount;
+    baked->IsSdf = ImFontAtlasFontUseSdf(atlas, font);
+    baked->IsLcd = ImFontAtlasFontUseLcd(atlas, font);
 
     // Initialize backend data
     size_t loader_data_size = 0;
@@ -3807,6 +4009,10 @@ ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_si
         loader_data_p += loader->FontBakedSrcLoaderDataSize;
     }
 
+    // Populate from persistent glyph cache
+    if (atlas->GlyphCache != NULL)
+        ImFontAtlasGlyphCacheLoadBaked(atlas, baked);
+
     ImFontAtlasBuildSetupFontBakedBlanks(atlas, baked);
     return baked;
 }
@@ -3884,6 +4090,32 @@ void ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFont* font, int unused_fr
         }
 }
 
+bool ImFontAtlasFontUseSdf(ImFontAtlas* atlas, ImFont* font)
+{
+    if ((font->Flags & ImFontFlags_SDF) == 0 || !atlas->RendererHasSdfText)
+        return false;
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (!loader->HasSdf)
+            return false;
+    }
+    return true;
+}
+
+bool ImFontAtlasFontUseLcd(ImFontAtlas* atlas, ImFont* font)
+{
+    if ((font->Flags & ImFontFlags_LCD) == 0 || !atlas->RendererHasLcdText || atlas->TexDesiredFormat != ImTextureFormat_RGBA32 || ImFontAtlasFontUseSdf(atlas, font))
+        return false;
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (!loader->HasLcd)
+            return false;
+    }
+    return true;
+}
+
 // use unused_frames==0 to discard everything.
 void ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames)
 {
@@ -3899,6 +4131,32 @@ void ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames)
     }
 }
 
+// Discard least recently used bakes first, until 'surface' pixels were discarded. Return false if there was nothing to discard.
+// Space is then reused for new glyphs without repacking, while bakes used a few frames ago (e.g. while zooming back and forth) are kept rather than rasterized again.
+static bool ImFontAtlasBuildDiscardLeastRecentlyUsedBakes(ImFontAtlas* atlas, int unused_frames, int surface)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const int surface_target = builder->RectsDiscardedSurface + surface;
+    bool discarded_any = false;
+    while (builder->RectsDiscardedSurface < surface_target)
+    {
+        ImFontBaked* oldest = NULL;
+        for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        {
+            ImFontBaked* baked = &builder->BakedPool[baked_n];
+            if (baked->LastUsedFrame + unused_frames > builder->FrameCount || baked->WantDestroy || (baked->OwnerFont->Flags & ImFontFlags_LockBakedSizes))
+                continue;
+            if (oldest == NULL || baked->LastUsedFrame < oldest->LastUsedFrame)
+                oldest = baked;
+        }
+        if (oldest == NULL)
+            break;
+        ImFontAtlasBakedDiscard(atlas, oldest->OwnerFont, oldest);
+        discarded_any = true;
+    }
+    return discarded_any;
+}
+
 // Those functions are designed to facilitate changing the underlying structures for ImFontAtlas to store an array of ImDrawListSharedData*
 void ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data)
 {
@@ -3949,85 +4207,578 @@ void ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas)
         }
 }
 
-// Set current texture. This is mostly called from AddTexture() + to handle a failed resize.
-static void ImFontAtlasBuildSetTexture(ImFontAtlas* atlas, ImTextureData* tex)
-{
-    ImTextureRef old_tex_ref = atlas->TexRef;
-    atlas->TexData = tex;
-    atlas->TexUvScale = ImVec2(1.0f / tex->Width, 1.0f / tex->Height);
-    atlas->TexRef._TexData = tex;
-    //atlas->TexRef._TexID = tex->TexID; // <-- We intentionally don't do that. It would be misleading and betray promise that both fields aren't set.
-    ImFontAtlasUpdateDrawListsTextures(atlas, old_tex_ref, atlas->TexRef);
-}
+//-----------------------------------------------------------------------------------------------------------------------------
+// Asynchronous glyph rasterization (see ImFontAtlas::GlyphJobDispatchFunc, ImFontAtlasGlyphJob)
+//-----------------------------------------------------------------------------------------------------------------------------
 
-// Create a new texture, discard previous one
-ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
-{
-    ImTextureData* old_tex = atlas->TexData;
-    ImTextureData* new_tex;
+#if defined(_MSC_VER) && !defined(__clang__)
+static int  ImFontAtlasGlyphJobGetState(ImFontAtlasGlyphJob* job)              { return (int)_InterlockedOr((volatile long*)&job->State, 0); }
+static void ImFontAtlasGlyphJobSetState(ImFontAtlasGlyphJob* job, int state)   { _InterlockedExchange((volatile long*)&job->State, (long)state); }
+#else
+static int  ImFontAtlasGlyphJobGetState(ImFontAtlasGlyphJob* job)              { return __atomic_load_n(&job->State, __ATOMIC_ACQUIRE); }
+static void ImFontAtlasGlyphJobSetState(ImFontAtlasGlyphJob* job, int state)   { __atomic_store_n(&job->State, state, __ATOMIC_RELEASE); }
+#endif
 
-    // FIXME: Cannot reuse texture because old UV may have been used already (unless we remap UV).
-    /*if (old_tex != NULL && old_tex->Status == ImTextureStatus_WantCreate)
-    {
-        // Reuse texture not yet used by backend.
-        IM_ASSERT(old_tex->TexID == ImTextureID_Invalid && old_tex->BackendUserData == NULL);
-        old_tex->DestroyPixels();
-        old_tex->Updates.clear();
-        new_tex = old_tex;
-        old_tex = NULL;
-    }
-    else*/
-    {
-        // Add new
-        new_tex = IM_NEW(ImTextureData)();
-        new_tex->UniqueID = atlas->TexNextUniqueID++;
-        atlas->TexList.push_back(new_tex);
-    }
-    if (old_tex != NULL)
+// Wait for a job handed to another thread, as we have no way to run it ourselves.
+// Rasterizing a glyph is quick: spin with a CPU pause hint, then give our time slice to other threads, then sleep (e.g. worker busy with other jobs).
+static void ImFontAtlasGlyphJobWaitDone(ImFontAtlasGlyphJob* job)
+{
+    for (int spin_count = 0; ImFontAtlasGlyphJobGetState(job) != ImFontAtlasGlyphJobState_Done; spin_count++)
     {
-        // Queue old as to destroy next frame
-        old_tex->WantDestroyNextFrame = true;
-        IM_ASSERT(old_tex->Status == ImTextureStatus_OK || old_tex->Status == ImTextureStatus_WantCreate || old_tex->Status == ImTextureStatus_WantUpdates);
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+        if (spin_count >= 1100)
+        {
+            ::Sleep(1); // Shortest sleep available: one scheduler tick
+            continue;
+        }
+        if (spin_count >= 1000)
+        {
+            ::SwitchToThread();
+            continue;
+        }
+#elif !defined(_WIN32)
+        if (spin_count >= 1100)
+        {
+            const struct timespec delay = { 0, 100 * 1000 }; // 0.1 ms
+            nanosleep(&delay, NULL);
+            continue;
+        }
+        if (spin_count >= 1000)
+        {
+            sched_yield();
+            continue;
+        }
+#endif
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_IX86) || defined(_M_X64))
+        _mm_pause();
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_ARM64)
+        __yield();
+#elif defined(__i386__) || defined(__x86_64__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        __asm__ __volatile__("yield");
+#endif
     }
+}
 
-    new_tex->Create(atlas->TexDesiredFormat, w, h);
-    atlas->TexIsBuilt = false;
+// Called by font loader when packing a glyph. The job needs to be filled, then passed to ImFontAtlasBuildDispatchGlyphJob().
+ImFontAtlasGlyphJob* ImFontAtlasBuildAddGlyphJob(ImFontAtlas* atlas, ImFontBaked* baked, ImFontAtlasRectId pack_id, int w, int h)
+{
+    if (atlas->GlyphJobDispatchFunc == NULL || (!atlas->RendererHasTextures && !atlas->Builder->PreloadingGlyphs))
+        return NULL;
+    ImFontAtlasGlyphJob* job = IM_NEW(ImFontAtlasGlyphJob)();
+    job->State = ImFontAtlasGlyphJobState_Queued;
+    job->Font = baked->OwnerFont;
+    job->BakedId = baked->BakedId;
+    job->PackId = pack_id;
+    job->GlyphIndexHint = baked->Glyphs.Size; // Glyph is added right after this
+    job->Width = w;
+    job->Height = h;
+    job->Pixels.resize(w * h);
+    memset(job->Pixels.Data, 0, (size_t)job->Pixels.size_in_bytes());
+    atlas->Builder->GlyphJobs.push_back(job);
+    return job;
+}
 
-    ImFontAtlasBuildSetTexture(atlas, new_tex);
+void ImFontAtlasBuildDispatchGlyphJob(ImFontAtlas* atlas, ImFontAtlasGlyphJob* job)
+{
+    IM_ASSERT(job->RasterizeFunc != NULL);
+    atlas->GlyphJobDispatchFunc(atlas, job);
+}
 
-    return new_tex;
+void ImFontAtlas::RunGlyphJob(ImFontAtlasGlyphJob* job)
+{
+    IM_ASSERT(ImFontAtlasGlyphJobGetState(job) == ImFontAtlasGlyphJobState_Queued && "RunGlyphJob() called twice for the same job?");
+    ImFontAtlasGlyphJobSetState(job, ImFontAtlasGlyphJobState_Running);
+    job->RasterizeFunc(job, job->Pixels.Data);
+    ImFontAtlasGlyphJobSetState(job, ImFontAtlasGlyphJobState_Done);
 }
 
-#if 0
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include "../stb/stb_image_write.h"
-static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* description)
+// Copy pixels to texture and make glyph visible.
+// The glyph is looked up again as it may have been discarded (along with its baked font) while rasterizing.
+static void ImFontAtlasBuildApplyGlyphJob(ImFontAtlas* atlas, const ImFontAtlasGlyphJob* job, const unsigned char* pixels)
 {
-    ImGuiContext& g = *GImGui;
-    char buf[128];
-    ImFormatString(buf, IM_ARRAYSIZE(buf), "[%05d] Texture #%03d - %s.png", g.FrameCount, tex->UniqueID, description);
-    stbi_write_png(buf, tex->Width, tex->Height, tex->BytesPerPixel, tex->Pixels, tex->GetPitch()); // tex->BytesPerPixel is technically not component, but ok for the formats we support.
+    ImFontBaked* baked = (ImFontBaked*)atlas->Builder->BakedMap.GetVoidPtr(job->BakedId);
+    if (baked == NULL)
+        return;
+    ImFontGlyph* glyph = NULL;
+    if (job->GlyphIndexHint < baked->Glyphs.Size && baked->Glyphs[job->GlyphIndexHint].PackId == job->PackId)
+        glyph = &baked->Glyphs[job->GlyphIndexHint];
+    else
+        for (ImFontGlyph& baked_glyph : baked->Glyphs)
+            if (baked_glyph.PackId == job->PackId)
+            {
+                glyph = &baked_glyph;
+                break;
+            }
+    if (glyph == NULL || glyph->Visible)
+        return;
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, job->PackId);
+    ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, baked->OwnerFont->Sources[glyph->SourceIdx], glyph, r, pixels, ImTextureFormat_Alpha8, job->Width);
+    glyph->Visible = true;
 }
-#endif
 
-void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
+// Called by ImFontAtlasUpdateNewFrame()
+void ImFontAtlasBuildUpdateGlyphJobs(ImFontAtlas* atlas)
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
-    builder->LockDisableResize = true;
+    int dst_n = 0;
+    for (ImFontAtlasGlyphJob* job : builder->GlyphJobs)
+    {
+        if (ImFontAtlasGlyphJobGetState(job) != ImFontAtlasGlyphJobState_Done)
+        {
+            builder->GlyphJobs[dst_n++] = job;
+            continue;
+        }
+        ImFontAtlasBuildApplyGlyphJob(atlas, job, job->Pixels.Data);
+        builder->GlyphJobsCompletedCount++;
+        IM_DELETE(job);
+    }
+    builder->GlyphJobs.resize(dst_n);
+}
 
-    ImTextureData* old_tex = atlas->TexData;
-    ImTextureData* new_tex = ImFontAtlasTextureAdd(atlas, w, h);
-    new_tex->UseColors = old_tex->UseColors;
-    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: resize+repack %dx%d => Texture #%03d: %dx%d\n", old_tex->UniqueID, old_tex->Width, old_tex->Height, new_tex->UniqueID, new_tex->Width, new_tex->Height);
-    //for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
-    //    IMGUI_DEBUG_LOG_FONT("[font] - Baked %.2fpx, %d glyphs, want_destroy=%d\n", builder->BakedPool[baked_n].FontSize, builder->BakedPool[baked_n].Glyphs.Size, builder->BakedPool[baked_n].WantDestroy);
-    //IMGUI_DEBUG_LOG_FONT("[font] - Old packed rects: %d, area %d px\n", builder->RectsPackedCount, builder->RectsPackedSurface);
-    //ImFontAtlasDebugWriteTexToDisk(old_tex, "Before Pack");
+// Wait for all jobs and copy their results into the texture. Used when glyphs need to be rendered before returning (e.g. preloading for legacy backends).
+void ImFontAtlasBuildFinishGlyphJobs(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (ImFontAtlasGlyphJob* job : builder->GlyphJobs)
+        ImFontAtlasGlyphJobWaitDone(job);
+    ImFontAtlasBuildUpdateGlyphJobs(atlas);
+    IM_ASSERT(builder->GlyphJobs.Size == 0);
+}
+
+// Rasterize a pending glyph on the calling thread, when its pixels are needed now (e.g. to build the ellipsis from the dot).
+// The job keeps running and its result will be ignored.
+void ImFontAtlasBuildFlushGlyphJob(ImFontAtlas* atlas, ImFontAtlasRectId pack_id)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (ImFontAtlasGlyphJob* job : builder->GlyphJobs)
+        if (job->PackId == pack_id)
+        {
+            builder->TempBuffer.resize(job->Width * job->Height);
+            memset(builder->TempBuffer.Data, 0, (size_t)builder->TempBuffer.size_in_bytes());
+            job->RasterizeFunc(job, builder->TempBuffer.Data);
+            ImFontAtlasBuildApplyGlyphJob(atlas, job, builder->TempBuffer.Data);
+            return;
+        }
+}
+
+// Wait for jobs which may be reading font loader data, before destroying it. Their results are dropped.
+void ImFontAtlasBuildWaitGlyphJobs(ImFontAtlas* atlas, ImFont* font)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL)
+        return;
+    int dst_n = 0;
+    for (ImFontAtlasGlyphJob* job : builder->GlyphJobs)
+    {
+        if (font != NULL && job->Font != font)
+        {
+            builder->GlyphJobs[dst_n++] = job;
+            continue;
+        }
+        ImFontAtlasGlyphJobWaitDone(job);
+        IM_DELETE(job);
+    }
+    builder->GlyphJobs.resize(dst_n);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Persistent glyph cache (see ImFontAtlas::LoadGlyphCacheFromDisk(), ImFontAtlasGlyphCache)
+//-----------------------------------------------------------------------------------------------------------------------------
+
+// Identify everything which affects rasterized pixels and metrics of a baked font.
+ImGuiID ImFontAtlasGlyphCacheGetBakedKey(ImFontAtlas* atlas, ImFontBaked* baked)
+{
+    ImGuiID key = ImHashData(&baked->Size, sizeof(baked->Size));
+    key = ImHashData(&baked->RasterizerDensity, sizeof(baked->RasterizerDensity), key);
+    const int is_sdf = baked->IsSdf;
+    key = ImHashData(&is_sdf, sizeof(is_sdf), key);
+    const int is_lcd = baked->IsLcd;
+    key = ImHashData(&is_lcd, sizeof(is_lcd), key);
+    key = ImHashData(&atlas->FontLoaderFlags, sizeof(atlas->FontLoaderFlags), key);
+    for (ImFontConfig* src : baked->OwnerFont->Sources)
+    {
+        if (src->FontData == NULL) // Custom loaders generating their own glyphs
+            return 0;
+        if (src->FontDataHash == 0)
+            src->FontDataHash = ImHashData(src->FontData, (size_t)src->FontDataSize);
+
+        // Hash settings, without pointers (memcpy() to preserve zero-initialized padding)
+        ImFontConfig cfg;
+        memcpy(&cfg, src, sizeof(cfg));
+        memset(cfg.Name, 0, sizeof(cfg.Name));
+        cfg.FontData = NULL;
+        cfg.FontDataOwnedByAtlas = false;
+        cfg.GlyphRanges = cfg.GlyphExcludeRanges = NULL;
+        cfg.DstFont = NULL;
+        cfg.FontLoader = NULL;
+        cfg.FontLoaderData = NULL;
+        key = ImHashData(&cfg, sizeof(cfg), key);
+        if (src->GlyphExcludeRanges != NULL)
+            for (const ImWchar* p = src->GlyphExcludeRanges; p[0] != 0; p++)
+                key = ImHashData(p, sizeof(*p), key);
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        key = ImHashStr(loader->Name ? loader->Name : "", 0, key);
+    }
+    return (key != 0) ? key : 1;
+}
+
+void ImFontAtlasGlyphCacheLoadBaked(ImFontAtlas* atlas, ImFontBaked* baked)
+{
+    ImFontAtlasGlyphCache* cache = atlas->GlyphCache;
+    ImTextureData* tex = atlas->TexData;
+    if (cache->EntriesMap.Data.Size == 0 || tex == NULL || tex->Pixels == NULL)
+        return;
+    ImGuiID key = ImFontAtlasGlyphCacheGetBakedKey(atlas, baked);
+    int entry_offset = (key != 0) ? cache->EntriesMap.GetInt(key, 0) : 0;
+    if (entry_offset == 0)
+        return;
+
+    const ImFontAtlasGlyphCacheEntry* entry = (const ImFontAtlasGlyphCacheEntry*)(const void*)(cache->Data.Data + entry_offset - 1);
+    const ImFontAtlasGlyphCacheGlyph* cached_glyphs = (const ImFontAtlasGlyphCacheGlyph*)(const void*)(entry + 1);
+    const unsigned char* pixels = (const unsigned char*)(cached_glyphs + entry->GlyphsCount);
+    const ImTextureFormat pixels_fmt = (ImTextureFormat)entry->PixelsFormat;
+    const int bpp = ImTextureDataGetFormatBytesPerPixel(pixels_fmt);
+
+    // Source indices can only be validated against the font: reject the whole entry rather than loading part of it
+    for (int glyph_n = 0; glyph_n < entry->GlyphsCount; glyph_n++)
+        if ((int)cached_glyphs[glyph_n].SourceIdx >= baked->OwnerFont->Sources.Size)
+        {
+            IMGUI_DEBUG_LOG_FONT("[font] Glyph cache entry for baked %.2fpx has invalid source index, ignoring it\n", baked->Size);
+            return;
+        }
+
+    int glyphs_loaded = 0;
+    for (int glyph_n = 0; glyph_n < entry->GlyphsCount; glyph_n++)
+    {
+        const ImFontAtlasGlyphCacheGlyph* src_glyph = &cached_glyphs[glyph_n];
+        if (baked->IsGlyphLoaded((ImWchar)src_glyph->Codepoint))
+            continue;
+
+        ImFontGlyph glyph;
+        glyph.Codepoint = src_glyph->Codepoint;
+        glyph.Colored = src_glyph->Colored;
+        glyph.Visible = src_glyph->Visible;
+        glyph.SourceIdx = src_glyph->SourceIdx;
+        glyph.AdvanceX = src_glyph->AdvanceX;
+        glyph.X0 = src_glyph->X0;
+        glyph.Y0 = src_glyph->Y0;
+        glyph.X1 = src_glyph->X1;
+        glyph.Y1 = src_glyph->Y1;
+        if (src_glyph->Width > 0 && src_glyph->Height > 0)
+        {
+            const int w = src_glyph->Width;
+            const int h = src_glyph->Height;
+            ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+            if (pack_id == ImFontAtlasRectId_Invalid)
+                break; // Remaining glyphs will go through the font loader
+            ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+            tex = ImFontAtlasPackGetPageTexture(atlas, ImFontAtlasPackGetRectPage(atlas, pack_id)); // May have been changed by packing
+            ImFontAtlasTextureBlockConvert(pixels + src_glyph->PixelsOffset, pixels_fmt, w * bpp, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), w, h);
+            ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, w, h);
+            glyph.PackId = pack_id;
+        }
+        ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, &glyph); // Metrics are final: don't pass source to apply them again
+        glyphs_loaded++;
+    }
+    cache->BakedLoadedCount++;
+    cache->GlyphsLoadedCount += glyphs_loaded;
+    IMGUI_DEBUG_LOG_FONT("[font] Loaded %d glyphs from glyph cache for baked %.2fpx\n", glyphs_loaded, baked->Size);
+}
+
+static ImFontAtlasGlyphCache* ImFontAtlasGlyphCacheGetOrCreate(ImFontAtlas* atlas)
+{
+    if (atlas->GlyphCache == NULL)
+        atlas->GlyphCache = IM_NEW(ImFontAtlasGlyphCache)();
+    return atlas->GlyphCache;
+}
+
+// Validate all entries first, so the rest of the code doesn't need to check.
+static bool ImFontAtlasGlyphCacheBuildMap(ImFontAtlasGlyphCache* cache)
+{
+    cache->EntriesMap.Clear();
+    const int data_size = cache->Data.Size;
+    const ImFontAtlasGlyphCacheHeader* header = (const ImFontAtlasGlyphCacheHeader*)(const void*)cache->Data.Data;
+    if (data_size < (int)sizeof(ImFontAtlasGlyphCacheHeader) || memcmp(header->Magic, "IMGC", 4) != 0 || header->Version != IM_FONTATLAS_GLYPHCACHE_VERSION || header->ImGuiVersionNum != IMGUI_VERSION_NUM)
+        return false;
+
+    ImVector<ImGuiStoragePair> entries;
+    int offset = (int)sizeof(ImFontAtlasGlyphCacheHeader);
+    for (int entry_n = 0; entry_n < header->EntriesCount; entry_n++)
+    {
+        if (data_size - offset < (int)sizeof(ImFontAtlasGlyphCacheEntry))
+            return false;
+        const ImFontAtlasGlyphCacheEntry* entry = (const ImFontAtlasGlyphCacheEntry*)(const void*)(cache->Data.Data + offset);
+        if (entry->GlyphsCount < 0 || entry->PixelsSize < 0 || (entry->PixelsSize & 3) != 0 || (entry->PixelsFormat != ImTextureFormat_RGBA32 && entry->PixelsFormat != ImTextureFormat_Alpha8))
+            return false;
+        if (entry->GlyphsCount > (data_size - offset - (int)sizeof(ImFontAtlasGlyphCacheEntry)) / (int)sizeof(ImFontAtlasGlyphCacheGlyph))
+            return false;
+        const int glyphs_size = entry->GlyphsCount * (int)sizeof(ImFontAtlasGlyphCacheGlyph);
+        if (entry->PixelsSize > data_size - offset - (int)sizeof(ImFontAtlasGlyphCacheEntry) - glyphs_size)
+            return false;
+        const ImFontAtlasGlyphCacheGlyph* glyphs = (const ImFontAtlasGlyphCacheGlyph*)(const void*)(entry + 1);
+        const int bpp = ImTextureDataGetFormatBytesPerPixel((ImTextureFormat)entry->PixelsFormat);
+        for (int glyph_n = 0; glyph_n < entry->GlyphsCount; glyph_n++)
+        {
+            const ImFontAtlasGlyphCacheGlyph* glyph = &glyphs[glyph_n];
+            if (glyph->Codepoint > IM_UNICODE_CODEPOINT_MAX || glyph->PixelsOffset < 0 || glyph->PixelsOffset > entry->PixelsSize)
+                return false;
+            if ((ImU64)glyph->Width * glyph->Height * (ImU64)bpp > (ImU64)(entry->PixelsSize - glyph->PixelsOffset)) // 64-bit: 65535 * 65535 * 4 overflows an int
+                return false;
+            if (glyph->Visible != (glyph->Width > 0 && glyph->Height > 0))
+                return false;
+        }
+        entries.push_back(ImGuiStoragePair(entry->Key, offset + 1));
+        offset += (int)sizeof(ImFontAtlasGlyphCacheEntry) + glyphs_size + entry->PixelsSize;
+    }
+
+    // Sort once, rather than inserting entries one by one
+    cache->EntriesMap.Data.swap(entries);
+    cache->EntriesMap.BuildSortByKey();
+    return true;
+}
+
+bool ImFontAtlas::LoadGlyphCacheFromDisk(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    if (data == NULL)
+        return false;
+    bool ret = LoadGlyphCacheFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
+}
+
+bool ImFontAtlas::LoadGlyphCacheFromMemory(const void* data, size_t data_size)
+{
+    ImFontAtlasGlyphCache* cache = ImFontAtlasGlyphCacheGetOrCreate(this);
+    if (data_size >= 0x7FFFFFFF)
+        data_size = 0;
+    cache->Data.resize((int)data_size);
+    if (data_size > 0)
+        memcpy(cache->Data.Data, data, data_size);
+    if (ImFontAtlasGlyphCacheBuildMap(cache))
+        return true;
+    IMGUI_DEBUG_LOG_FONT("[font] Ignoring invalid or outdated glyph cache data.\n");
+    cache->Data.clear();
+    cache->EntriesMap.Clear();
+    return false;
+}
+
+// Write glyphs which are fully rasterized and present in the texture.
+static void ImFontAtlasGlyphCacheWriteBaked(ImFontAtlas* atlas, ImFontBaked* baked, ImGuiID key, ImVector<char>* out)
+{
+    ImTextureData* tex = atlas->TexData;
+    const int bpp = tex->BytesPerPixel;
+    int glyphs_count = 0;
+    int pixels_size = 0;
+    for (int glyph_idx = 0; glyph_idx < baked->Glyphs.Size; glyph_idx++)
+    {
+        const ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
+        if (baked->IndexLookup[glyph->Codepoint] != glyph_idx) // Discarded
+            continue;
+        if (glyph->Visible != (glyph->PackId != ImFontAtlasRectId_Invalid)) // Rasterizing on another thread, or failed packing
+            continue;
+        if (glyph->PackId != ImFontAtlasRectId_Invalid)
+        {
+            ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+            pixels_size += r->w * r->h * bpp;
+        }
+        glyphs_count++;
+    }
+    const int glyphs_size = glyphs_count * (int)sizeof(ImFontAtlasGlyphCacheGlyph);
+    pixels_size = IM_MEMALIGN(pixels_size, 4);
+
+    const int entry_offset = out->Size;
+    out->resize(out->Size + (int)sizeof(ImFontAtlasGlyphCacheEntry) + glyphs_size + pixels_size);
+    memset(out->Data + entry_offset, 0, (size_t)(out->Size - entry_offset));
+    ImFontAtlasGlyphCacheEntry* entry = (ImFontAtlasGlyphCacheEntry*)(void*)(out->Data + entry_offset);
+    entry->Key = key;
+    entry->GlyphsCount = glyphs_count;
+    entry->PixelsFormat = tex->Format;
+    entry->PixelsSize = pixels_size;
+    ImFontAtlasGlyphCacheGlyph* dst_glyph = (ImFontAtlasGlyphCacheGlyph*)(void*)(entry + 1);
+    unsigned char* pixels = (unsigned char*)(void*)(dst_glyph + glyphs_count);
+    int pixels_offset = 0;
+    for (int glyph_idx = 0; glyph_idx < baked->Glyphs.Size; glyph_idx++)
+    {
+        const ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
+        if (baked->IndexLookup[glyph->Codepoint] != glyph_idx || glyph->Visible != (glyph->PackId != ImFontAtlasRectId_Invalid))
+            continue;
+        dst_glyph->Codepoint = glyph->Codepoint;
+        dst_glyph->Colored = glyph->Colored;
+        dst_glyph->Visible = glyph->Visible;
+        dst_glyph->SourceIdx = glyph->SourceIdx;
+        dst_glyph->AdvanceX = glyph->AdvanceX;
+        dst_glyph->X0 = glyph->X0;
+        dst_glyph->Y0 = glyph->Y0;
+        dst_glyph->X1 = glyph->X1;
+        dst_glyph->Y1 = glyph->Y1;
+        dst_glyph->PixelsOffset = pixels_offset;
+        if (glyph->PackId != ImFontAtlasRectId_Invalid)
+        {
+            ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+            tex = ImFontAtlasPackGetPageTexture(atlas, glyph->PageIndex);
+            dst_glyph->Width = r->w;
+            dst_glyph->Height = r->h;
+            ImFontAtlasTextureBlockConvert((const unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), pixels + pixels_offset, tex->Format, r->w * bpp, r->w, r->h);
+            pixels_offset += r->w * r->h * bpp;
+        }
+        dst_glyph++;
+    }
+}
+
+const void* ImFontAtlas::SaveGlyphCacheToMemory(size_t* out_size)
+{
+    ImFontAtlasGlyphCache* cache = ImFontAtlasGlyphCacheGetOrCreate(this);
+    ImVector<char> out;
+    out.resize((int)sizeof(ImFontAtlasGlyphCacheHeader));
+    memset(out.Data, 0, out.Size);
+    int entries_count = 0;
+
+    // Write live baked fonts
+    ImGuiStorage written_keys;
+    if (Builder != NULL && TexData != NULL && TexData->Pixels != NULL)
+        for (int baked_n = 0; baked_n < Builder->BakedPool.Size; baked_n++)
+        {
+            ImFontBaked* baked = &Builder->BakedPool[baked_n];
+            if (baked->WantDestroy || baked->Glyphs.Size == 0)
+                continue;
+            ImGuiID key = ImFontAtlasGlyphCacheGetBakedKey(this, baked);
+            if (key == 0 || written_keys.GetBool(key))
+                continue;
+            written_keys.SetBool(key, true);
+            ImFontAtlasGlyphCacheWriteBaked(this, baked, key, &out);
+            entries_count++;
+        }
+
+    // Carry over loaded entries which weren't used this session
+    for (ImGuiStoragePair& pair : cache->EntriesMap.Data)
+    {
+        if (written_keys.GetBool(pair.key))
+            continue;
+        const ImFontAtlasGlyphCacheEntry* entry = (const ImFontAtlasGlyphCacheEntry*)(const void*)(cache->Data.Data + pair.val_i - 1);
+        const int entry_size = (int)sizeof(ImFontAtlasGlyphCacheEntry) + entry->GlyphsCount * (int)sizeof(ImFontAtlasGlyphCacheGlyph) + entry->PixelsSize;
+        const int dst_offset = out.Size;
+        out.resize(out.Size + entry_size);
+        memcpy(out.Data + dst_offset, entry, (size_t)entry_size);
+        entries_count++;
+    }
+
+    ImFontAtlasGlyphCacheHeader* header = (ImFontAtlasGlyphCacheHeader*)(void*)out.Data;
+    memcpy(header->Magic, "IMGC", 4);
+    header->Version = IM_FONTATLAS_GLYPHCACHE_VERSION;
+    header->ImGuiVersionNum = IMGUI_VERSION_NUM;
+    header->EntriesCount = entries_count;
+
+    // Saved data becomes the new cache contents
+    cache->Data.swap(out);
+    ImFontAtlasGlyphCacheBuildMap(cache);
+    if (out_size)
+        *out_size = (size_t)cache->Data.Size;
+    return cache->Data.Data;
+}
+
+bool ImFontAtlas::SaveGlyphCacheToDisk(const char* filename)
+{
+    size_t data_size = 0;
+    const void* data = SaveGlyphCacheToMemory(&data_size);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ret = ImFileWrite(data, 1, data_size, f) == data_size;
+    ImFileClose(f);
+    return ret;
+}
+
+// Set current texture. This is mostly called from AddTexture() + to handle a failed resize.
+static void ImFontAtlasBuildSetTexture(ImFontAtlas* atlas, ImTextureData* tex)
+{
+    ImTextureRef old_tex_ref = atlas->TexRef;
+    atlas->TexData = tex;
+    atlas->TexUvScale = ImVec2(1.0f / tex->Width, 1.0f / tex->Height);
+    atlas->TexRef._TexData = tex;
+    //atlas->TexRef._TexID = tex->TexID; // <-- We intentionally don't do that. It would be misleading and betray promise that both fields aren't set.
+    ImFontAtlasUpdateDrawListsTextures(atlas, old_tex_ref, atlas->TexRef);
+}
+
+// Create a new texture, discard previous one
+ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
+{
+    ImTextureData* old_tex = atlas->TexData;
+    ImTextureData* new_tex;
+
+    // FIXME: Cannot reuse texture because old UV may have been used already (unless we remap UV).
+    /*if (old_tex != NULL && old_tex->Status == ImTextureStatus_WantCreate)
+    {
+        // Reuse texture not yet used by backend.
+        IM_ASSERT(old_tex->TexID == ImTextureID_Invalid && old_tex->BackendUserData == NULL);
+        old_tex->DestroyPixels();
+        old_tex->Updates.clear();
+        new_tex = old_tex;
+        old_tex = NULL;
+    }
+    else*/
+    {
+        // Add new
+        new_tex = IM_NEW(ImTextureData)();
+        new_tex->UniqueID = atlas->TexNextUniqueID++;
+        atlas->TexList.push_back(new_tex);
+    }
+    if (old_tex != NULL)
+    {
+        // Queue old as to destroy next frame
+        old_tex->WantDestroyNextFrame = true;
+        IM_ASSERT(old_tex->Status == ImTextureStatus_OK || old_tex->Status == ImTextureStatus_WantCreate || old_tex->Status == ImTextureStatus_WantUpdates);
+    }
+
+    new_tex->Create(atlas->TexDesiredFormat, w, h);
+    atlas->TexIsBuilt = false;
+
+    ImFontAtlasBuildSetTexture(atlas, new_tex);
+
+    return new_tex;
+}
+
+#if 0
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "../stb/stb_image_write.h"
+static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* description)
+{
+    ImGuiContext& g = *GImGui;
+    char buf[128];
+    ImFormatString(buf, IM_ARRAYSIZE(buf), "[%05d] Texture #%03d - %s.png", g.FrameCount, tex->UniqueID, description);
+    stbi_write_png(buf, tex->Width, tex->Height, tex->BytesPerPixel, tex->Pixels, tex->GetPitch()); // tex->BytesPerPixel is technically not component, but ok for the formats we support.
+}
+#endif
+
+void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(builder->Pages.Size == 0 && "Multi-page atlas is never repacked.");
+    builder->LockDisableResize = true;
+
+    ImTextureData* old_tex = atlas->TexData;
+    ImTextureData* new_tex = ImFontAtlasTextureAdd(atlas, w, h);
+    new_tex->UseColors = old_tex->UseColors;
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: resize+repack %dx%d => Texture #%03d: %dx%d\n", old_tex->UniqueID, old_tex->Width, old_tex->Height, new_tex->UniqueID, new_tex->Width, new_tex->Height);
+    //for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    //    IMGUI_DEBUG_LOG_FONT("[font] - Baked %.2fpx, %d glyphs, want_destroy=%d\n", builder->BakedPool[baked_n].FontSize, builder->BakedPool[baked_n].Glyphs.Size, builder->BakedPool[baked_n].WantDestroy);
+    //IMGUI_DEBUG_LOG_FONT("[font] - Old packed rects: %d, area %d px\n", builder->RectsPackedCount, builder->RectsPackedSurface);
+    //ImFontAtlasDebugWriteTexToDisk(old_tex, "Before Pack");
 
     // Repack, lose discarded rectangle, copy pixels
     // FIXME-NEWATLAS: This is unstable because packing order is based on RectsIndex
     // FIXME-NEWATLAS-V2: Repacking in batch would be beneficial to packing heuristic, and fix stability.
     // FIXME-NEWATLAS-TESTS: Test calling RepackTexture with size too small to fits existing rects.
+    ImVector<ImVec2i> old_skyline;
+    ImVector<ImTextureRect> old_free_rects;
+    old_skyline.swap(builder->PackSkyline);
+    old_free_rects.swap(builder->PackFreeRects);
+    const int old_free_surface = builder->PackFreeSurface;
+    const int old_packed_count = builder->RectsPackedCount, old_packed_surface = builder->RectsPackedSurface;
+    const ImVec2i old_max_rect_size = builder->MaxRectSize, old_max_rect_bounds = builder->MaxRectBounds;
     ImFontAtlasPackInit(atlas);
     ImVector<ImTextureRect> old_rects;
     ImVector<ImFontAtlasRectEntry> old_index = builder->RectsIndex;
@@ -4047,8 +4798,16 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
             // FIXME-NEWATLAS-TESTS: This is a very rarely exercised path! It needs to be automatically tested properly.
             IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: resize failed. Will grow.\n", new_tex->UniqueID);
             new_tex->WantDestroyNextFrame = true;
+            old_tex->WantDestroyNextFrame = false;
             builder->Rects.swap(old_rects);
             builder->RectsIndex = old_index;
+            builder->PackSkyline.swap(old_skyline);
+            builder->PackFreeRects.swap(old_free_rects);
+            builder->PackFreeSurface = old_free_surface;
+            builder->RectsPackedCount = old_packed_count;
+            builder->RectsPackedSurface = old_packed_surface;
+            builder->MaxRectSize = old_max_rect_size;
+            builder->MaxRectBounds = old_max_rect_bounds;
             ImFontAtlasBuildSetTexture(atlas, old_tex);
             ImFontAtlasTextureGrow(atlas, w, h); // Recurse
             return;
@@ -4086,6 +4845,11 @@ void ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
 {
     //ImFontAtlasDebugWriteTexToDisk(atlas->TexData, "Before Grow");
     ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->Pages.Size > 0)
+    {
+        ImFontAtlasTextureAddPage(atlas);
+        return;
+    }
     if (old_tex_w == -1)
         old_tex_w = atlas->TexData->Width;
     if (old_tex_h == -1)
@@ -4114,22 +4878,82 @@ void ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
     ImFontAtlasTextureRepack(atlas, new_tex_w, new_tex_h);
 }
 
-void ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas)
+static bool ImFontAtlasPackHasSpace(ImFontAtlas* atlas, int w, int h);
+
+// Make space for a w*h rectangle (padding included), caller will try packing it again.
+// Return false when nothing could be done, in which case trying again is pointless.
+bool ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas, int w, int h)
 {
     // Can some baked contents be ditched?
     //IMGUI_DEBUG_LOG_FONT("[font] ImFontAtlasBuildMakeSpace()\n");
     ImFontAtlasBuilder* builder = atlas->Builder;
-    ImFontAtlasBuildDiscardBakes(atlas, 2);
+    const int discarded_count = builder->RectsDiscardedCount;
+
+    // Multi-page atlas: add a page, existing ones are left untouched.
+    if (builder->Pages.Size > 0)
+    {
+        ImFontAtlasBuildDiscardBakes(atlas, 2);
+        if (builder->RectsDiscardedCount == discarded_count)
+            return ImFontAtlasTextureAddPage(atlas);
+        return true;
+    }
 
-    // Currently using a heuristic for repack without growing.
-    if (builder->RectsDiscardedSurface < builder->RectsPackedSurface * 0.20f)
+    // Ditch least recently used bakes, a few at a time, until freed space fits the rectangle. Stop if free space is getting low:
+    // squeezing into an almost full texture would keep evicting fonts which are still in use, only to rasterize them again.
+    // Then grow as the old packer did, or repack when free space is fragmented or texture can't grow anymore.
+    const float min_free_ratio = 0.20f;
+    while (ImFontAtlasBuildDiscardLeastRecentlyUsedBakes(atlas, 2, atlas->TexData->Width * atlas->TexData->Height / 32))
+    {
+        if (ImFontAtlasPackHasSpace(atlas, w, h))
+            return true;
+        if (builder->PackFreeSurface < (builder->RectsPackedSurface - builder->RectsDiscardedSurface) * min_free_ratio)
+            break;
+    }
+    ImTextureData* old_tex = atlas->TexData;
+    const bool enough_free_space = builder->PackFreeSurface >= (builder->RectsPackedSurface - builder->RectsDiscardedSurface) * min_free_ratio;
+    if (!enough_free_space)
         ImFontAtlasTextureGrow(atlas);
-    else
+    if (atlas->TexData == old_tex)
+    {
+        ImFontAtlasBuildDiscardBakes(atlas, 2); // Repacking cost and frequency grow with live contents: ditch everything unused first
         ImFontAtlasTextureRepack(atlas, atlas->TexData->Width, atlas->TexData->Height);
+    }
+    return true;
+}
+
+// Multi-page atlas needs the backend to create new textures on demand.
+static bool ImFontAtlasBuildWantPages(ImFontAtlas* atlas)
+{
+    return atlas->TexPageSize > 0 && atlas->RendererHasTextures;
+}
+
+// Create a new fixed-size texture page, which becomes the current page for packing.
+// Pages are listed before TexData in TexList[], and destroyed along with the builder.
+bool ImFontAtlasTextureAddPage(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(builder->Pages.Size > 0);
+    if (builder->Pages.Size >= IM_FONTATLAS_PAGES_MAX)
+        return false;
+
+    ImTextureData* tex = IM_NEW(ImTextureData)();
+    tex->UniqueID = atlas->TexNextUniqueID++;
+    tex->Create(atlas->TexDesiredFormat, atlas->TexData->Width, atlas->TexData->Height);
+    atlas->TexList.insert(atlas->TexList.end() - 1, tex);
+
+    builder->Pages.push_back(ImFontAtlasPage());
+    ImFontAtlasPage* page = &builder->Pages.back();
+    page->Tex = tex;
+    page->PackSkyline.push_back(ImVec2i(0, 0));
+    ImFontAtlasPackSetCurrentPage(atlas, builder->Pages.Size - 1);
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: added page %d (%dx%d)\n", tex->UniqueID, builder->Pages.Size - 1, tex->Width, tex->Height);
+    return true;
 }
 
 ImVec2i ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas)
 {
+    if (ImFontAtlasBuildWantPages(atlas))
+        return ImVec2i(atlas->TexPageSize, atlas->TexPageSize);
     int min_w = ImUpperPowerOfTwo(atlas->TexMinWidth);
     int min_h = ImUpperPowerOfTwo(atlas->TexMinHeight);
     if (atlas->Builder == NULL || atlas->TexData == NULL || atlas->TexData->Status == ImTextureStatus_WantDestroy)
@@ -4182,6 +5006,8 @@ void ImFontAtlasTextureCompact(ImFontAtlas* atlas)
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
     ImFontAtlasBuildDiscardBakes(atlas, 1);
+    if (builder->Pages.Size > 0)
+        return; // Space is reused by next glyphs, pages are never repacked.
 
     ImTextureData* old_tex = atlas->TexData;
     ImVec2i old_tex_size = ImVec2i(old_tex->Width, old_tex->Height);
@@ -4212,57 +5038,497 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
     }
 
     // Create initial texture size
-    if (atlas->TexData == NULL || atlas->TexData->Pixels == NULL)
-        ImFontAtlasTextureAdd(atlas, ImUpperPowerOfTwo(atlas->TexMinWidth), ImUpperPowerOfTwo(atlas->TexMinHeight));
+    ImFontAtlasBuildUpdateRendererHasTexturesFromContext(atlas);
+    const bool use_pages = ImFontAtlasBuildWantPages(atlas);
+    if (use_pages)
+        IM_ASSERT(ImIsPowerOfTwo(atlas->TexPageSize) && atlas->TexPageSize <= atlas->TexMaxWidth && atlas->TexPageSize <= atlas->TexMaxHeight && "TexPageSize must be a power of two, no larger than TexMaxWidth/TexMaxHeight.");
+    if (atlas->TexData == NULL || atlas->TexData->Pixels == NULL || (use_pages && (atlas->TexData->Width != atlas->TexPageSize || atlas->TexData->Height != atlas->TexPageSize)))
+    {
+        ImVec2i new_tex_size = ImFontAtlasTextureGetSizeEstimate(atlas); // Minimum size, or page size
+        ImFontAtlasTextureAdd(atlas, new_tex_size.x, new_tex_size.y);
+    }
 
     atlas->Builder = IM_NEW(ImFontAtlasBuilder)();
     if (atlas->FontLoader->LoaderInit)
         atlas->FontLoader->LoaderInit(atlas);
 
-    ImFontAtlasBuildUpdateRendererHasTexturesFromContext(atlas);
+    ImFontAtlasPackInit(atlas);
+    if (use_pages)
+        atlas->Builder->Pages.push_back(ImFontAtlasPage()); // Page 0 is TexData
+
+    // Add required texture data
+    ImFontAtlasBuildUpdateLinesTexData(atlas);
+    ImFontAtlasBuildUpdateBasicTexData(atlas);
+
+    // Register fonts
+    ImFontAtlasBuildUpdatePointers(atlas);
+
+    // Update UV coordinates etc. stored in bound ImDrawListSharedData instance
+    ImFontAtlasUpdateDrawListsSharedData(atlas);
+
+    //atlas->TexIsBuilt = true;
+}
+
+// Destroy builder and all cached glyphs. Do not destroy actual fonts.
+void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
+{
+    for (ImFont* font : atlas->Fonts)
+        ImFontAtlasFontDestroyOutput(atlas, font);
+    if (atlas->Builder && atlas->FontLoader && atlas->FontLoader->LoaderShutdown)
+    {
+        atlas->FontLoader->LoaderShutdown(atlas);
+        IM_ASSERT(atlas->FontLoaderData == NULL);
+    }
+    ImFontAtlasBuildWaitGlyphJobs(atlas, NULL);
+    if (atlas->Builder)
+    {
+        for (ImFontAtlasPage& page : atlas->Builder->Pages)
+            if (page.Tex != NULL)
+                page.Tex->WantDestroyNextFrame = true;
+        atlas->Builder->Pages.clear_destruct();
+    }
+    IM_DELETE(atlas->Builder);
+    atlas->Builder = NULL;
+}
+
+#define IM_FONTATLAS_PACK_MIN_FREE_SIZE     4   // Free space thinner than this is not tracked by the packer (until next repack)
+
+void ImFontAtlasPackInit(ImFontAtlas * atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+
+    // Start with a single skyline node spanning the whole texture width, which is expected to be cleared.
+    builder->PackSkyline.resize(1);
+    builder->PackSkyline[0] = ImVec2i(0, 0);
+    builder->PackFreeRects.resize(0);
+    builder->PackFreeSurface = 0;
+    builder->PackDefragIdle = true;
+    builder->PackDefragBandY = builder->PackDefragPrevBandY = 0;
+    builder->RectsPackedSurface = builder->RectsPackedCount = 0;
+    builder->MaxRectSize = ImVec2i(0, 0);
+    builder->MaxRectBounds = ImVec2i(0, 0);
+}
+
+// Multi-page atlas: store packer state of current page and restore the one of 'page_n'.
+void ImFontAtlasPackSetCurrentPage(ImFontAtlas* atlas, int page_n)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->PagesCurrent == page_n)
+        return;
+    ImFontAtlasPage* old_page = &builder->Pages[builder->PagesCurrent];
+    ImFontAtlasPage* new_page = &builder->Pages[page_n];
+    old_page->PackSkyline.swap(builder->PackSkyline);
+    old_page->PackFreeRects.swap(builder->PackFreeRects);
+    old_page->PackFreeSurface = builder->PackFreeSurface;
+    builder->PackSkyline.swap(new_page->PackSkyline);
+    builder->PackFreeRects.swap(new_page->PackFreeRects);
+    builder->PackFreeSurface = new_page->PackFreeSurface;
+    builder->PagesCurrent = page_n;
+}
+
+// Return index of skyline node spanning 'x'
+static int ImFontAtlasPackSkylineFindNode(const ImVector<ImVec2i>& nodes, int x)
+{
+    int lo = 0, hi = nodes.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) / 2;
+        if (nodes[mid].x <= x)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Set skyline height over [x0,x1) to 'y', splitting and merging nodes as needed.
+static void ImFontAtlasPackSkylineSetSpan(ImVector<ImVec2i>& nodes, int tex_w, int x0, int x1, int y)
+{
+    const int first = ImFontAtlasPackSkylineFindNode(nodes, x0);
+    int last = first;
+    while (last + 1 < nodes.Size && nodes[last + 1].x < x1)
+        last++;
+    const int last_x1 = (last + 1 < nodes.Size) ? nodes[last + 1].x : tex_w;
+
+    // Replace nodes [first..last] with up to 3 nodes: head of first node, the span, tail of last node.
+    ImVec2i new_nodes[3];
+    int new_count = 0;
+    if (nodes[first].x < x0)
+        new_nodes[new_count++] = nodes[first];
+    new_nodes[new_count++] = ImVec2i(x0, y);
+    if (last_x1 > x1)
+        new_nodes[new_count++] = ImVec2i(x1, nodes[last].y);
+    for (int old_count = last - first + 1; old_count != new_count; )
+    {
+        if (old_count < new_count)
+            nodes.insert(nodes.Data + first, ImVec2i(0, 0)), old_count++;
+        else
+            nodes.erase(nodes.Data + first), old_count--;
+    }
+    for (int n = 0; n < new_count; n++)
+        nodes[first + n] = new_nodes[n];
+
+    // Merge neighbors of same height
+    for (int n = ImMax(first, 1); n < nodes.Size && n <= first + new_count; )
+        if (nodes[n].y == nodes[n - 1].y)
+            nodes.erase(nodes.Data + n);
+        else
+            n++;
+}
+
+// Return true if skyline is exactly at the bottom of 'r' over its whole width, i.e. nothing was packed below it.
+static bool ImFontAtlasPackSkylineIsOnTop(const ImVector<ImVec2i>& nodes, const ImTextureRect& r)
+{
+    const int y1 = r.y + r.h;
+    for (int n = ImFontAtlasPackSkylineFindNode(nodes, r.x); n < nodes.Size && nodes[n].x < r.x + r.w; n++)
+        if (nodes[n].y != y1)
+            return false;
+    return true;
+}
+
+// Add free rectangle, merging it with existing ones sharing a full edge.
+static void ImFontAtlasPackAddFreeRect(ImFontAtlasBuilder* builder, ImTextureRect r)
+{
+    builder->PackFreeSurface += r.w * r.h;
+    for (int n = 0; n < builder->PackFreeRects.Size; n++)
+    {
+        const ImTextureRect& f = builder->PackFreeRects[n];
+        const bool merge_x = (f.y == r.y && f.h == r.h && (f.x + f.w == r.x || r.x + r.w == f.x));
+        const bool merge_y = (f.x == r.x && f.w == r.w && (f.y + f.h == r.y || r.y + r.h == f.y));
+        if (!merge_x && !merge_y)
+            continue;
+        if (merge_x)
+            r.x = ImMin(r.x, f.x), r.w = (unsigned short)(r.w + f.w);
+        else
+            r.y = ImMin(r.y, f.y), r.h = (unsigned short)(r.h + f.h);
+        builder->PackFreeRects.erase_unsorted(&f);
+        n = -1; // Merged rectangle may now share an edge with another one
+    }
+    builder->PackFreeRects.push_back(r);
+}
+
+// Return index of smallest free rectangle fitting w*h above 'max_y', or -1.
+static int ImFontAtlasPackFindFreeRect(ImFontAtlasBuilder* builder, int w, int h, int max_y = INT_MAX)
+{
+    int best_n = -1;
+    int best_surface = INT_MAX;
+    for (int n = 0; n < builder->PackFreeRects.Size; n++)
+    {
+        const ImTextureRect& f = builder->PackFreeRects[n];
+        const int surface = f.w * f.h;
+        if (f.w >= w && f.h >= h && f.y + h <= max_y && surface < best_surface)
+        {
+            best_n = n;
+            best_surface = surface;
+            if (f.w == w && f.h == h)
+                break; // Exact fit, e.g. glyph rasterized again after its baked font was discarded
+        }
+    }
+    return best_n;
+}
+
+// Allocate w*h at the top-left corner of a free rectangle, splitting remaining space along the shorter leftover axis (guillotine).
+static ImVec2i ImFontAtlasPackUseFreeRect(ImFontAtlasBuilder* builder, int free_n, int w, int h)
+{
+    const ImTextureRect f = builder->PackFreeRects[free_n];
+    builder->PackFreeRects.erase_unsorted(&builder->PackFreeRects[free_n]);
+    builder->PackFreeSurface -= f.w * f.h;
+    const bool split_horizontal = (f.w - w) < (f.h - h);
+    ImTextureRect right = { (unsigned short)(f.x + w), f.y, (unsigned short)(f.w - w), (unsigned short)(split_horizontal ? h : f.h) };
+    ImTextureRect bottom = { f.x, (unsigned short)(f.y + h), (unsigned short)(split_horizontal ? f.w : w), (unsigned short)(f.h - h) };
+    // Leftovers don't need merging: they were part of a single free rectangle, which wasn't sharing a full edge with another one.
+    if (right.w >= IM_FONTATLAS_PACK_MIN_FREE_SIZE && right.h >= IM_FONTATLAS_PACK_MIN_FREE_SIZE)
+        builder->PackFreeRects.push_back(right), builder->PackFreeSurface += right.w * right.h;
+    if (bottom.w >= IM_FONTATLAS_PACK_MIN_FREE_SIZE && bottom.h >= IM_FONTATLAS_PACK_MIN_FREE_SIZE)
+        builder->PackFreeRects.push_back(bottom), builder->PackFreeSurface += bottom.w * bottom.h;
+    return ImVec2i(f.x, f.y);
+}
+
+// Return index of skyline node where to pack w*h on top of the skyline, or -1. Bottom-left heuristic: lowest position, then least wasted area.
+static int ImFontAtlasPackSkylineFindPos(const ImVector<ImVec2i>& nodes, int tex_w, int tex_h, int w, int h, int* out_y)
+{
+    int best_n = -1, best_y = INT_MAX, best_waste = INT_MAX;
+    for (int n = 0; n < nodes.Size && nodes[n].x + w <= tex_w; n++)
+    {
+        const int x1 = nodes[n].x + w;
+        int y = 0;
+        for (int m = n; m < nodes.Size && nodes[m].x < x1; m++)
+            y = ImMax(y, nodes[m].y);
+        if (y + h > tex_h || y > best_y)
+            continue;
+        int waste = 0;
+        for (int m = n; m < nodes.Size && nodes[m].x < x1; m++)
+            waste += (y - nodes[m].y) * (ImMin(x1, (m + 1 < nodes.Size) ? nodes[m + 1].x : tex_w) - nodes[m].x);
+        if (y < best_y || waste < best_waste)
+        {
+            best_n = n;
+            best_y = y;
+            best_waste = waste;
+        }
+    }
+    *out_y = best_y;
+    return best_n;
+}
+
+// Return true if a w*h rectangle (padding included) would fit, without packing it.
+static bool ImFontAtlasPackHasSpace(ImFontAtlas* atlas, int w, int h)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    int y;
+    return ImFontAtlasPackFindFreeRect(builder, w, h) != -1 || ImFontAtlasPackSkylineFindPos(builder->PackSkyline, atlas->TexData->Width, atlas->TexData->Height, w, h, &y) != -1;
+}
+
+// Find space for a w*h rectangle (padding included) above 'max_y'. Free rectangles are reused first, then we pack on top of the skyline.
+static bool ImFontAtlasPackFindSpaceEx(ImFontAtlas* atlas, int w, int h, int max_y, ImVec2i* out_pos)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const int free_n = ImFontAtlasPackFindFreeRect(builder, w, h, max_y);
+    if (free_n != -1)
+    {
+        *out_pos = ImFontAtlasPackUseFreeRect(builder, free_n, w, h);
+        return true;
+    }
+
+    ImVector<ImVec2i>& nodes = builder->PackSkyline;
+    const int tex_w = atlas->TexData->Width;
+    int best_y;
+    const int best_n = ImFontAtlasPackSkylineFindPos(nodes, tex_w, ImMin(atlas->TexData->Height, max_y), w, h, &best_y);
+    if (best_n == -1)
+        return false;
+
+    // Space wasted below the rectangle is lost until next repack.
+    const int x0 = nodes[best_n].x;
+    const int x1 = x0 + w;
+    ImFontAtlasPackSkylineSetSpan(nodes, tex_w, x0, x1, best_y + h);
+    *out_pos = ImVec2i(x0, best_y);
+    return true;
+}
+
+static void ImFontAtlasPackDefragCancel(ImFontAtlas* atlas);
+
+// While ImFontAtlasTextureDefrag() is emptying the bottom band of texture, pack above it, unless there is no space left there.
+static bool ImFontAtlasPackFindSpace(ImFontAtlas* atlas, int w, int h, ImVec2i* out_pos)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->PackDefragBandY > 0)
+    {
+        if (ImFontAtlasPackFindSpaceEx(atlas, w, h, builder->PackDefragBandY, out_pos))
+            return true;
+        ImFontAtlasPackDefragCancel(atlas);
+    }
+    return ImFontAtlasPackFindSpaceEx(atlas, w, h, INT_MAX, out_pos);
+}
 
-    ImFontAtlasPackInit(atlas);
+// Lower skyline over 'r' which top is on the skyline. Free rectangles right below it may then be reached by the skyline too.
+static void ImFontAtlasPackSkylineLower(ImFontAtlasBuilder* builder, int tex_w, const ImTextureRect& r)
+{
+    ImFontAtlasPackSkylineSetSpan(builder->PackSkyline, tex_w, r.x, r.x + r.w, r.y);
+    for (int n = 0; n < builder->PackFreeRects.Size; n++)
+    {
+        const ImTextureRect f = builder->PackFreeRects[n];
+        if (f.y + f.h != r.y || f.x >= r.x + r.w || f.x + f.w <= r.x || !ImFontAtlasPackSkylineIsOnTop(builder->PackSkyline, f))
+            continue;
+        builder->PackFreeRects.erase_unsorted(&builder->PackFreeRects[n]);
+        builder->PackFreeSurface -= f.w * f.h;
+        ImFontAtlasPackSkylineLower(builder, tex_w, f);
+        n = -1; // List was modified
+    }
+}
 
-    // Add required texture data
-    ImFontAtlasBuildUpdateLinesTexData(atlas);
-    ImFontAtlasBuildUpdateBasicTexData(atlas);
+// Give back space (padding included). Pixels are left as-is: ImFontAtlasPackClearPadding() clears them when space is reused.
+static void ImFontAtlasPackReleaseSpace(ImFontAtlas* atlas, const ImTextureRect& r)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (ImFontAtlasPackSkylineIsOnTop(builder->PackSkyline, r))
+        ImFontAtlasPackSkylineLower(builder, atlas->TexData->Width, r);
+    else
+        ImFontAtlasPackAddFreeRect(builder, r);
+}
 
-    // Register fonts
-    ImFontAtlasBuildUpdatePointers(atlas);
+// Space used by a w*h rectangle may have been used by discarded rectangles: clear padding on all sides, which are the only pixels sampled next to contents.
+// Contents are not cleared: caller is expected to write all of them. Padding on left/top sides is shared with neighbors, which never write to it.
+static void ImFontAtlasPackClearPadding(ImFontAtlas* atlas, ImTextureData* tex, int x, int y, int w, int h)
+{
+    const int pack_padding = atlas->TexGlyphPadding;
+    const int x0 = ImMax(x - pack_padding, 0), x1 = x + w + pack_padding;
+    const int y0 = ImMax(y - pack_padding, 0), y1 = y + h + pack_padding;
+    ImFontAtlasTextureBlockFill(tex, x0, y0, x1 - x0, y - y0, IM_COL32_BLACK_TRANS);
+    ImFontAtlasTextureBlockFill(tex, x0, y + h, x1 - x0, y1 - (y + h), IM_COL32_BLACK_TRANS);
+    ImFontAtlasTextureBlockFill(tex, x0, y, x - x0, h, IM_COL32_BLACK_TRANS);
+    ImFontAtlasTextureBlockFill(tex, x + w, y, x1 - (x + w), h, IM_COL32_BLACK_TRANS);
+    ImFontAtlasTextureBlockQueueUpload(atlas, tex, x0, y0, x1 - x0, y1 - y0);
+}
 
-    // Update UV coordinates etc. stored in bound ImDrawListSharedData instance
-    ImFontAtlasUpdateDrawListsSharedData(atlas);
+// Defragmentation empties the band of texture below PackDefragBandY, while packing is restricted above it.
+static void ImFontAtlasPackDefragCancel(ImFontAtlas* atlas)
+{
+    atlas->Builder->PackDefragBandY = 0;
+}
 
-    //atlas->TexIsBuilt = true;
+static int IMGUI_CDECL TextureRectComparerByBottom(const void* lhs, const void* rhs)
+{
+    const ImTextureRect* a = (const ImTextureRect*)lhs;
+    const ImTextureRect* b = (const ImTextureRect*)rhs;
+    return (a->y + a->h) - (b->y + b->h);
 }
 
-// Destroy builder and all cached glyphs. Do not destroy actual fonts.
-void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
+// Rectangles were moved out of the band: give it back to the skyline, except over rectangles left in it
+// (which didn't fit elsewhere, or can't be moved). Free space below new skyline is dropped.
+static void ImFontAtlasPackDefragCommit(ImFontAtlas* atlas)
 {
-    for (ImFont* font : atlas->Fonts)
-        ImFontAtlasFontDestroyOutput(atlas, font);
-    if (atlas->Builder && atlas->FontLoader && atlas->FontLoader->LoaderShutdown)
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const int band_y = builder->PackDefragBandY;
+    const int pack_padding = atlas->TexGlyphPadding;
+    const int tex_w = atlas->TexData->Width;
+    ImVector<ImVec2i>& nodes = builder->PackSkyline;
+    for (ImVec2i& node : nodes)
+        node.y = ImMin(node.y, band_y);
+    for (int n = 1; n < nodes.Size; )
+        if (nodes[n].y == nodes[n - 1].y)
+            nodes.erase(nodes.Data + n);
+        else
+            n++;
+
+    // Raise skyline over rectangles left in band, from top to bottom so that lower ones win.
+    ImVector<ImTextureRect>& remaining = builder->PackDefragRects;
+    remaining.resize(0);
+    for (const ImTextureRect& r : builder->Rects)
+        if (r.w > 0 && r.y + r.h + pack_padding > band_y)
+        {
+            ImTextureRect padded_r = { r.x, r.y, (unsigned short)(r.w + pack_padding), (unsigned short)(r.h + pack_padding) };
+            remaining.push_back(padded_r);
+        }
+    ImQsort(remaining.Data, (size_t)remaining.Size, sizeof(ImTextureRect), TextureRectComparerByBottom);
+    for (const ImTextureRect& r : remaining)
+        ImFontAtlasPackSkylineSetSpan(nodes, tex_w, r.x, r.x + r.w, r.y + r.h);
+
+    // Free rectangles need to stay fully below the skyline
+    for (int n = 0; n < builder->PackFreeRects.Size; n++)
     {
-        atlas->FontLoader->LoaderShutdown(atlas);
-        IM_ASSERT(atlas->FontLoaderData == NULL);
+        ImTextureRect& f = builder->PackFreeRects[n];
+        if (f.y + f.h <= band_y)
+            continue;
+        bool below_skyline = true;
+        for (int node_n = ImFontAtlasPackSkylineFindNode(nodes, f.x); node_n < nodes.Size && nodes[node_n].x < f.x + f.w && below_skyline; node_n++)
+            below_skyline = (nodes[node_n].y >= f.y + f.h);
+        if (below_skyline)
+            continue;
+        builder->PackFreeSurface -= f.w * f.h;
+        if (band_y - f.y >= IM_FONTATLAS_PACK_MIN_FREE_SIZE)
+        {
+            f.h = (unsigned short)(band_y - f.y);
+            builder->PackFreeSurface += f.w * f.h;
+        }
+        else
+        {
+            builder->PackFreeRects.erase_unsorted(&f);
+            n--;
+        }
     }
-    IM_DELETE(atlas->Builder);
-    atlas->Builder = NULL;
+    builder->PackDefragBandY = 0;
 }
 
-void ImFontAtlasPackInit(ImFontAtlas * atlas)
+// Incrementally defragment texture, without creating a new one. Called once per frame by ImFontAtlasUpdateNewFrame().
+// Glyphs from the bottom band of the texture are moved into free space above it, up to 'max_pixels' per frame. Once all
+// were tried, the band is given back to the skyline as one contiguous area, and the next band is processed. Only moved
+// glyphs are uploaded. UVs of moved glyphs are updated in place, which is fine as no draw command of the new frame has
+// been recorded yet. Not used with a multi-page atlas, where glyphs never move.
+void ImFontAtlasTextureDefrag(ImFontAtlas* atlas, int max_pixels)
 {
-    ImTextureData* tex = atlas->TexData;
     ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->PackDefragIdle || builder->LockDisableResize || builder->Pages.Size > 0)
+        return;
+    const int pack_padding = atlas->TexGlyphPadding;
+    if (builder->PackDefragBandY == 0)
+    {
+        // Only bother when free space is fragmented enough that next ImFontAtlasTextureMakeSpace() could repack.
+        const int live_surface = builder->RectsPackedSurface - builder->RectsDiscardedSurface;
+        if (builder->PackFreeSurface < live_surface * 0.20f)
+        {
+            builder->PackDefragIdle = true;
+            return;
+        }
 
-    // In theory we could decide to reduce the number of nodes, e.g. halve them, and waste a little texture space, but it doesn't seem worth it.
-    const int pack_node_count = tex->Width / 2;
-    builder->PackNodes.resize(pack_node_count);
-    IM_STATIC_ASSERT(sizeof(stbrp_context) <= sizeof(stbrp_context_opaque));
-    stbrp_init_target((stbrp_context*)(void*)&builder->PackContext, tex->Width, tex->Height, builder->PackNodes.Data, builder->PackNodes.Size);
-    builder->RectsPackedSurface = builder->RectsPackedCount = 0;
-    builder->MaxRectSize = ImVec2i(0, 0);
-    builder->MaxRectBounds = ImVec2i(0, 0);
+        // Pick band above lowest skyline node, or above previous band. Contents need to fit comfortably in free space above it.
+        int band_y1 = 0;
+        for (const ImVec2i& node : builder->PackSkyline)
+            band_y1 = ImMax(band_y1, node.y);
+        if (builder->PackDefragPrevBandY > 0)
+            band_y1 = ImMin(band_y1, builder->PackDefragPrevBandY);
+        const int band_y = band_y1 - ImMax(atlas->TexData->Height / 16, builder->MaxRectSize.y + pack_padding);
+        int band_surface = 0, free_surface = 0;
+        for (const ImTextureRect& r : builder->Rects)
+            if (r.w > 0 && r.y + r.h + pack_padding > band_y && r.y < band_y1)
+                band_surface += (r.w + pack_padding) * (r.h + pack_padding);
+        for (const ImTextureRect& f : builder->PackFreeRects)
+            if (f.y < band_y)
+                free_surface += f.w * (ImMin(f.y + f.h, band_y) - f.y);
+        if (band_y <= 0 || band_surface * 2 > free_surface)
+        {
+            builder->PackDefragIdle = true;
+            return;
+        }
+        builder->PackDefragBandY = band_y;
+        builder->PackDefragBandSkipped = builder->PackDefragBandMoved = 0;
+    }
+    const int band_y = builder->PackDefragBandY;
+
+    // Gather glyphs in band, skipping those which didn't fit on previous frames. Glyphs keep their relative order across frames.
+    // Other rectangles (custom rectangles, glyphs still being rasterized by a glyph job) are left in place.
+    ImVector<ImFontGlyph*>& candidates = builder->PackDefragGlyphs;
+    candidates.resize(0);
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->WantDestroy)
+            continue;
+        for (ImFontGlyph& glyph : baked->Glyphs)
+            if (glyph.PackId != ImFontAtlasRectId_Invalid && glyph.Visible)
+            {
+                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
+                if (r->y + r->h + pack_padding > band_y)
+                    candidates.push_back(&glyph);
+            }
+    }
+
+    ImTextureData* tex = atlas->TexData;
+    int moved_pixels = 0;
+    for (int n = builder->PackDefragBandSkipped; n < candidates.Size; n++)
+    {
+        if (moved_pixels >= max_pixels)
+            return;
+        ImFontGlyph* glyph = candidates[n];
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+        const ImTextureRect old_r = { r->x, r->y, (unsigned short)(r->w + pack_padding), (unsigned short)(r->h + pack_padding) };
+        ImVec2i new_pos;
+        if (!ImFontAtlasPackFindSpaceEx(atlas, old_r.w, old_r.h, band_y, &new_pos))
+        {
+            builder->PackDefragBandSkipped++;
+            continue;
+        }
+
+        // Move pixels, then release previous location
+        ImFontAtlasTextureBlockCopy(tex, r->x, r->y, tex, new_pos.x, new_pos.y, r->w, r->h);
+        if (pack_padding > 0)
+            ImFontAtlasPackClearPadding(atlas, tex, new_pos.x, new_pos.y, r->w, r->h);
+        else
+            ImFontAtlasTextureBlockQueueUpload(atlas, tex, new_pos.x, new_pos.y, r->w, r->h);
+        r->x = (unsigned short)new_pos.x;
+        r->y = (unsigned short)new_pos.y;
+        glyph->U0 = (r->x) * atlas->TexUvScale.x;
+        glyph->V0 = (r->y) * atlas->TexUvScale.y;
+        glyph->U1 = (r->x + r->w) * atlas->TexUvScale.x;
+        glyph->V1 = (r->y + r->h) * atlas->TexUvScale.y;
+        ImFontAtlasPackReleaseSpace(atlas, old_r);
+        builder->PackDefragBandMoved++;
+        builder->PackDefragMovedCount++;
+        moved_pixels += r->w * r->h;
+    }
+
+    // Stop when a band couldn't be improved, until more space is released.
+    builder->PackDefragPrevBandY = band_y;
+    builder->PackDefragIdle = (builder->PackDefragBandMoved == 0);
+    ImFontAtlasPackDefragCommit(atlas);
 }
 
 // This is essentially a free-list pattern, it may be nice to wrap it into a dedicated type.
@@ -4299,7 +5565,7 @@ static ImFontAtlasRectId ImFontAtlasPackReuseRectEntry(ImFontAtlas* atlas, ImFon
     return ImFontAtlasRectId_Make(index_idx, index_entry->Generation);
 }
 
-// This is expected to be called in batches and followed by a repack
+// Space is reused by next packed rectangles.
 void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
 {
     IM_ASSERT(id != ImFontAtlasRectId_Invalid);
@@ -4307,6 +5573,7 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     ImTextureRect* rect = ImFontAtlasPackGetRect(atlas, id);
     if (rect == NULL)
         return;
+    const int page_n = ImFontAtlasPackGetRectPage(atlas, id);
 
     ImFontAtlasBuilder* builder = atlas->Builder;
     int index_idx = ImFontAtlasRectId_GetIndex(id);
@@ -4322,18 +5589,56 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     builder->RectsIndexFreeListStart = index_idx;
     builder->RectsDiscardedCount++;
     builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+
+    // Give space back to the packer. Pixels are left as-is: ImFontAtlasPackAddRect() clears them when space is reused.
+    // Restart defragmenting from the bottom of texture.
+    builder->PackDefragIdle = false;
+    builder->PackDefragPrevBandY = 0;
+    ImTextureRect free_r = { rect->x, rect->y, (unsigned short)(rect->w + pack_padding), (unsigned short)(rect->h + pack_padding) };
+    if (builder->Pages.Size > 0)
+        ImFontAtlasPackSetCurrentPage(atlas, page_n);
     rect->w = rect->h = 0; // Clear rectangle so it won't be packed again
+    ImFontAtlasPackReleaseSpace(atlas, free_r);
+}
+
+// Multi-page atlas: try current page first, then other pages starting from most recent ones.
+static bool ImFontAtlasPackFindSpaceInPages(ImFontAtlas* atlas, int w, int h, bool main_page_only, ImVec2i* out_pos)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (main_page_only && builder->Pages.Size > 0)
+        ImFontAtlasPackSetCurrentPage(atlas, 0);
+    if (ImFontAtlasPackFindSpace(atlas, w, h, out_pos))
+        return true;
+    if (main_page_only)
+        return false;
+    const int tried_page_n = builder->PagesCurrent;
+    for (int page_n = builder->Pages.Size - 1; page_n >= 0; page_n--)
+        if (page_n != tried_page_n)
+        {
+            ImFontAtlasPackSetCurrentPage(atlas, page_n);
+            if (ImFontAtlasPackFindSpace(atlas, w, h, out_pos))
+                return true;
+        }
+    return false;
 }
 
 // Important: Calling this may recreate a new texture and therefore change atlas->TexData
+// - 'main_page_only': with a multi-page atlas, pack into TexData (for rectangles which pixels/UV are accessed through atlas->TexRef).
 // FIXME-NEWFONTS: Expose other glyph padding settings for custom alteration (e.g. drop shadows). See #7962
-ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
+ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry, bool main_page_only)
 {
     IM_ASSERT(w > 0 && w <= 0xFFFF);
     IM_ASSERT(h > 0 && h <= 0xFFFF);
 
     ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
     const int pack_padding = atlas->TexGlyphPadding;
+
+    // Multi-page atlas: pages never grow, a rectangle larger than a page would never fit
+    if (builder->Pages.Size > 0 && (w + pack_padding > atlas->TexData->Width || h + pack_padding > atlas->TexData->Height))
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Failed packing %dx%d rectangle: larger than %dx%d page. Returning fallback.\n", w, h, atlas->TexData->Width, atlas->TexData->Height);
+        return ImFontAtlasRectId_Invalid;
+    }
     builder->MaxRectSize.x = ImMax(builder->MaxRectSize.x, w);
     builder->MaxRectSize.y = ImMax(builder->MaxRectSize.y, h);
 
@@ -4342,14 +5647,13 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
     for (int attempts_remaining = 3; attempts_remaining >= 0; attempts_remaining--)
     {
         // Try packing
-        stbrp_rect pack_r = {};
-        pack_r.w = w + pack_padding;
-        pack_r.h = h + pack_padding;
-        stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, &pack_r, 1);
-        r.x = (unsigned short)pack_r.x;
-        r.y = (unsigned short)pack_r.y;
-        if (pack_r.was_packed)
+        ImVec2i pos;
+        if (ImFontAtlasPackFindSpaceInPages(atlas, w + pack_padding, h + pack_padding, main_page_only, &pos))
+        {
+            r.x = (unsigned short)pos.x;
+            r.y = (unsigned short)pos.y;
             break;
+        }
 
         // If we ran out of attempts, return fallback
         if (attempts_remaining == 0 || builder->LockDisableResize)
@@ -4359,7 +5663,13 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
         }
 
         // Resize or repack atlas! (this should be a rare event)
-        ImFontAtlasTextureMakeSpace(atlas);
+        if (main_page_only && builder->Pages.Size > 0)
+            ImFontAtlasBuildDiscardBakes(atlas, 2); // A new page wouldn't help
+        else if (!ImFontAtlasTextureMakeSpace(atlas, w + pack_padding, h + pack_padding))
+        {
+            IMGUI_DEBUG_LOG_FONT("[font] Failed packing %dx%d rectangle: out of pages. Returning fallback.\n", w, h);
+            return ImFontAtlasRectId_Invalid;
+        }
     }
 
     builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, r.x + r.w + pack_padding);
@@ -4367,6 +5677,12 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
     builder->RectsPackedCount++;
     builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
 
+    // Space may have been used by discarded rectangles: clear padding. Repacking writes into a new texture which is already cleared.
+    if (overwrite_entry == NULL && pack_padding > 0)
+        ImFontAtlasPackClearPadding(atlas, ImFontAtlasPackGetPageTexture(atlas, builder->PagesCurrent), r.x, r.y, w, h);
+
+    if (builder->Pages.Size > 0)
+        builder->RectsPage.push_back((ImU8)builder->PagesCurrent);
     builder->Rects.push_back(r);
     if (overwrite_entry != NULL)
         return ImFontAtlasPackReuseRectEntry(atlas, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
@@ -4405,6 +5721,23 @@ ImTextureRect* ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId
     return &builder->Rects[index_entry->TargetIndex];
 }
 
+// Return texture page of a packed rectangle. Always 0 unless using a multi-page atlas.
+int ImFontAtlasPackGetRectPage(ImFontAtlas* atlas, ImFontAtlasRectId id)
+{
+    IM_ASSERT(id != ImFontAtlasRectId_Invalid);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->Pages.Size == 0)
+        return 0;
+    ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[ImFontAtlasRectId_GetIndex(id)];
+    IM_ASSERT(index_entry->Generation == ImFontAtlasRectId_GetGeneration(id) && index_entry->IsUsed);
+    return builder->RectsPage[index_entry->TargetIndex];
+}
+
+ImTextureData* ImFontAtlasPackGetPageTexture(ImFontAtlas* atlas, int page_n)
+{
+    return (page_n == 0) ? atlas->TexData : atlas->Builder->Pages[page_n].Tex;
+}
+
 // Important! This assume by ImFontConfig::GlyphExcludeRanges[] is a SMALL ARRAY (e.g. <10 entries)
 // Use "Input Glyphs Overlap Detection Tool" to display a list of glyphs provided by multiple sources in order to set this array up.
 static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar codepoint)
@@ -4425,6 +5758,21 @@ static void ImFontBaked_BuildGrowIndex(ImFontBaked* baked, int new_size)
     baked->IndexLookup.resize(new_size, IM_FONTGLYPH_INDEX_UNUSED);
 }
 
+static void ImFontBaked_ClearLatin1Index(ImFontBaked* baked)
+{
+    for (float& advance_x : baked->Latin1AdvanceX)
+        advance_x = -1.0f;
+    memset(baked->Latin1Glyphs, 0, sizeof(baked->Latin1Glyphs));
+}
+
+// Called when Glyphs[] has been reallocated
+static void ImFontBaked_RebaseLatin1Index(ImFontBaked* baked, const ImFontGlyph* old_glyphs)
+{
+    for (ImFontGlyph*& glyph : baked->Latin1Glyphs)
+        if (glyph != NULL)
+            glyph = baked->Glyphs.Data + (glyph - old_glyphs);
+}
+
 static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font, ImWchar* c)
 {
     IM_UNUSED(atlas);
@@ -4500,6 +5848,11 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
     ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
     baked->IndexAdvanceX[codepoint] = baked->FallbackAdvanceX;
     baked->IndexLookup[codepoint] = IM_FONTGLYPH_INDEX_NOT_FOUND;
+    if (codepoint < IM_ARRAYSIZE(baked->Latin1Glyphs))
+    {
+        baked->Latin1AdvanceX[codepoint] = baked->FallbackAdvanceX;
+        baked->Latin1Glyphs[codepoint] = &baked->Glyphs.Data[baked->FallbackGlyphIndex];
+    }
     return NULL;
 }
 
@@ -4592,6 +5945,7 @@ static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig*
         IM_ASSERT_USER_ERROR(0, "stbtt_InitFont(): failed to parse FontData. It is correct and complete? Check FontDataSize.");
         return false;
     }
+    bd_font_data->FontInfo.userdata = NULL;
     src->FontLoaderData = bd_font_data;
 
     const float ref_size = src->DstFont->Sources[0]->SizePixels;
@@ -4642,6 +5996,17 @@ static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig
     return true;
 }
 
+// Called by ImFontAtlas::RunGlyphJob(), on any thread
+static void ImGui_ImplStbTrueType_RasterizeGlyph(const ImFontAtlasGlyphJob* job, unsigned char* out_pixels)
+{
+    const ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (const ImGui_ImplStbTrueType_FontSrcData*)job->LoaderData;
+    stbtt_fontinfo font_info = bd_font_data->FontInfo;
+    font_info.userdata = (void*)job; // Select thread-safe allocator
+    float sub_x, sub_y;
+    stbtt_MakeGlyphBitmapSubpixelPrefilter(&font_info, out_pixels, job->Width, job->Height, job->Width,
+        job->LoaderScaleX, job->LoaderScaleY, 0, 0, job->LoaderOversampleH, job->LoaderOversampleV, &sub_x, &sub_y, job->LoaderGlyphIndex);
+}
+
 static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
 {
     // Search for first font which has the glyph
@@ -4682,12 +6047,91 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     const bool is_visible = (x0 != x1 && y0 != y1);
     if (is_visible)
     {
+        const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
+        const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+        float font_off_x = (src->GlyphOffset.x * offsets_scale);
+        float font_off_y = (src->GlyphOffset.y * offsets_scale);
+        if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
+            font_off_x = IM_ROUND(font_off_x);
+        if (src->PixelSnapV)
+            font_off_y = IM_ROUND(font_off_y);
+        font_off_y += IM_ROUND(baked->Ascent);
+
+        if (baked->IsSdf)
+        {
+            // Signed distance field (see ImFontFlags_SDF). No oversampling: the distance is interpolated by bilinear filtering.
+            // The field extends IM_FONTBAKED_SDF_SPREAD pixels around the glyph, and doesn't go through post-processing (e.g. RasterizerMultiply would alter distances).
+            int w, h, x_off, y_off;
+            unsigned char* sdf_pixels = stbtt_GetGlyphSDF(&bd_font_data->FontInfo, scale_for_layout * rasterizer_density, glyph_index, IM_FONTBAKED_SDF_SPREAD, 128, 128.0f / IM_FONTBAKED_SDF_SPREAD, &w, &h, &x_off, &y_off);
+            if (sdf_pixels == NULL)
+                return true;
+            ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+            if (pack_id == ImFontAtlasRectId_Invalid)
+            {
+                stbtt_FreeSDF(sdf_pixels, bd_font_data->FontInfo.userdata);
+                IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+                return false;
+            }
+            ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+            ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, ImFontAtlasPackGetRectPage(atlas, pack_id));
+            ImFontAtlasTextureBlockConvert(sdf_pixels, ImTextureFormat_Alpha8, w, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), w, h);
+            ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, w, h);
+            stbtt_FreeSDF(sdf_pixels, bd_font_data->FontInfo.userdata);
+
+            const float recip_density = 1.0f / rasterizer_density;
+            out_glyph->X0 = x_off * recip_density + font_off_x;
+            out_glyph->Y0 = y_off * recip_density + font_off_y;
+            out_glyph->X1 = (x_off + w) * recip_density + font_off_x;
+            out_glyph->Y1 = (y_off + h) * recip_density + font_off_y;
+            out_glyph->PackId = pack_id;
+            out_glyph->Visible = true;
+            return true;
+        }
+
+        if (baked->IsLcd)
+        {
+            // Subpixel coverage (see ImFontFlags_LCD). Rasterize at 3x horizontal resolution (one sample per R/G/B subpixel) instead of oversampling.
+            // Align samples on whole pixels so that each output pixel covers exactly 3 of them, then filter into RGBA32 pixels with padding.
+            const float scale_for_lcd_x = scale_for_layout * rasterizer_density * 3.0f;
+            const float scale_for_lcd_y = scale_for_layout * rasterizer_density;
+            int sx0, sy0, sx1, sy1;
+            stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_lcd_x, scale_for_lcd_y, &sx0, &sy0, &sx1, &sy1);
+            const int px0 = (int)ImFloor(sx0 / 3.0f);
+            const int px1 = (int)ImCeil(sx1 / 3.0f);
+            const int src_pitch = (px1 - px0) * 3;
+            const int w = px1 - px0 + IM_FONTBAKED_LCD_PADDING * 2;
+            const int h = sy1 - sy0;
+            ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+            if (pack_id == ImFontAtlasRectId_Invalid)
+            {
+                IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+                return false;
+            }
+            ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+
+            ImFontAtlasBuilder* builder = atlas->Builder;
+            builder->TempBuffer.resize(src_pitch * h);
+            unsigned char* subpixels = (unsigned char*)builder->TempBuffer.Data;
+            memset(subpixels, 0, (size_t)(src_pitch * h));
+            stbtt_MakeGlyphBitmap(&bd_font_data->FontInfo, subpixels + (sx0 - px0 * 3), sx1 - sx0, h, src_pitch, scale_for_lcd_x, scale_for_lcd_y, glyph_index);
+
+            const float recip_density = 1.0f / rasterizer_density;
+            out_glyph->X0 = (px0 - IM_FONTBAKED_LCD_PADDING) * recip_density + font_off_x;
+            out_glyph->Y0 = sy0 * recip_density + font_off_y;
+            out_glyph->X1 = (px1 + IM_FONTBAKED_LCD_PADDING) * recip_density + font_off_x;
+            out_glyph->Y1 = sy1 * recip_density + font_off_y;
+            out_glyph->PackId = pack_id;
+            out_glyph->Visible = true;
+            ImFontAtlasBakedSetFontGlyphBitmapLcd(atlas, baked, src, out_glyph, r, subpixels, src_pitch);
+            return true;
+        }
+
         const int w = (x1 - x0 + oversample_h - 1);
         const int h = (y1 - y0 + oversample_v - 1);
         ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
         if (pack_id == ImFontAtlasRectId_Invalid)
         {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight/TexPageSize set too small?)
             IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
             return false;
         }
@@ -4695,27 +6139,37 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
 
         // Render
         stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
-        ImFontAtlasBuilder* builder = atlas->Builder;
-        builder->TempBuffer.resize(w * h * 1);
-        unsigned char* bitmap_pixels = builder->TempBuffer.Data;
-        memset(bitmap_pixels, 0, w * h * 1);
-
-        // Render with oversampling
-        // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
         float sub_x, sub_y;
-        stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
-            scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+        unsigned char* bitmap_pixels = NULL;
+        ImFontAtlasGlyphJob* job = ImFontAtlasBuildAddGlyphJob(atlas, baked, pack_id, w, h);
+        if (job != NULL)
+        {
+            // Rasterize later on another thread. Apply same sub-pixel shift as stbtt_MakeGlyphBitmapSubpixelPrefilter() will.
+            job->RasterizeFunc = ImGui_ImplStbTrueType_RasterizeGlyph;
+            job->LoaderData = bd_font_data;
+            job->LoaderGlyphIndex = glyph_index;
+            job->LoaderScaleX = scale_for_raster_x;
+            job->LoaderScaleY = scale_for_raster_y;
+            job->LoaderOversampleH = oversample_h;
+            job->LoaderOversampleV = oversample_v;
+            sub_x = -(float)(oversample_h - 1) / (2.0f * oversample_h);
+            sub_y = -(float)(oversample_v - 1) / (2.0f * oversample_v);
+        }
+        else
+        {
+            ImFontAtlasBuilder* builder = atlas->Builder;
+            builder->TempBuffer.resize(w * h * 1);
+            bitmap_pixels = builder->TempBuffer.Data;
+            memset(bitmap_pixels, 0, w * h * 1);
+
+            // Render with oversampling
+            // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
+            stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
+                scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+        }
 
-        const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
-        const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
-        float font_off_x = (src->GlyphOffset.x * offsets_scale);
-        float font_off_y = (src->GlyphOffset.y * offsets_scale);
-        if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
-            font_off_x = IM_ROUND(font_off_x);
-        if (src->PixelSnapV)
-            font_off_y = IM_ROUND(font_off_y);
         font_off_x += sub_x;
-        font_off_y += sub_y + IM_ROUND(baked->Ascent);
+        font_off_y += sub_y;
         float recip_h = 1.0f / (oversample_h * rasterizer_density);
         float recip_v = 1.0f / (oversample_v * rasterizer_density);
 
@@ -4726,9 +6180,17 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         out_glyph->Y0 = y0 * recip_v + font_off_y;
         out_glyph->X1 = (x0 + (int)r->w) * recip_h + font_off_x;
         out_glyph->Y1 = (y0 + (int)r->h) * recip_v + font_off_y;
-        out_glyph->Visible = true;
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+        if (job != NULL)
+        {
+            out_glyph->Visible = false; // Not rendered until rasterized, see ImFontAtlasBuildUpdateGlyphJobs()
+            ImFontAtlasBuildDispatchGlyphJob(atlas, job);
+        }
+        else
+        {
+            out_glyph->Visible = true;
+            ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+        }
     }
 
     return true;
@@ -4744,6 +6206,8 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+    loader.HasSdf = true;
+    loader.HasLcd = true;
     return &loader;
 }
 
@@ -5075,6 +6539,7 @@ ImFontBaked::ImFontBaked()
 {
     memset(this, 0, sizeof(*this));
     FallbackGlyphIndex = -1;
+    ImFontBaked_ClearLatin1Index(this);
 }
 
 void ImFontBaked::ClearOutputData()
@@ -5083,6 +6548,12 @@ void ImFontBaked::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    ImFontBaked_ClearLatin1Index(this);
+    if (TextSizeCache != NULL)
+    {
+        IM_DELETE(TextSizeCache);
+        TextSizeCache = NULL;
+    }
     FallbackGlyphIndex = -1;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -5129,7 +6600,10 @@ bool ImFont::IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last)
 ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph)
 {
     int glyph_idx = baked->Glyphs.Size;
+    const ImFontGlyph* old_glyphs = baked->Glyphs.Data;
     baked->Glyphs.push_back(*in_glyph);
+    if (baked->Glyphs.Data != old_glyphs)
+        ImFontBaked_RebaseLatin1Index(baked, old_glyphs);
     ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
     IM_ASSERT(baked->Glyphs.Size < 0xFFFE); // IndexLookup[] hold 16-bit values and -1/-2 are reserved.
 
@@ -5142,6 +6616,7 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
         glyph->V0 = (r->y) * atlas->TexUvScale.y;
         glyph->U1 = (r->x + r->w) * atlas->TexUvScale.x;
         glyph->V1 = (r->y + r->h) * atlas->TexUvScale.y;
+        glyph->PageIndex = ImFontAtlasPackGetRectPage(atlas, glyph->PackId);
         baked->MetricsTotalSurface += r->w * r->h;
     }
 
@@ -5166,13 +6641,18 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
         glyph->AdvanceX = advance_x + src->GlyphExtraAdvanceX;
     }
     if (glyph->Colored)
-        atlas->TexPixelsUseColors = atlas->TexData->UseColors = true;
+        atlas->TexPixelsUseColors = ImFontAtlasPackGetPageTexture(atlas, glyph->PageIndex)->UseColors = true;
 
     // Update lookup tables
     const int codepoint = glyph->Codepoint;
     ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
     baked->IndexAdvanceX[codepoint] = glyph->AdvanceX;
     baked->IndexLookup[codepoint] = (ImU16)glyph_idx;
+    if (codepoint < IM_ARRAYSIZE(baked->Latin1Glyphs))
+    {
+        baked->Latin1AdvanceX[codepoint] = glyph->AdvanceX;
+        baked->Latin1Glyphs[codepoint] = glyph;
+    }
     const int page_n = codepoint / 8192;
     baked->OwnerFont->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
 
@@ -5200,12 +6680,14 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
 
     ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
     baked->IndexAdvanceX[codepoint] = advance_x;
+    if (codepoint < IM_ARRAYSIZE(baked->Latin1AdvanceX))
+        baked->Latin1AdvanceX[codepoint] = advance_x;
 }
 
 // Copy to texture, post-process and queue update for backend
 void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch)
 {
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, ImFontAtlasPackGetRectPage(atlas, glyph->PackId));
     IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
     ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
     ImFontAtlasPostProcessData pp_data = { atlas, baked->OwnerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
@@ -5213,6 +6695,18 @@ void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked,
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
 }
 
+// Fonts using ImFontFlags_LCD: 'src_subpixels' holds (r->w - IM_FONTBAKED_LCD_PADDING * 2) * 3 coverage samples per row. It is modified by post-processing.
+void ImFontAtlasBakedSetFontGlyphBitmapLcd(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, unsigned char* src_subpixels, int src_pitch)
+{
+    ImTextureData* tex = ImFontAtlasPackGetPageTexture(atlas, ImFontAtlasPackGetRectPage(atlas, glyph->PackId));
+    IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
+    IM_ASSERT(baked->IsLcd && tex->Format == ImTextureFormat_RGBA32);
+    ImFontAtlasPostProcessData pp_data = { atlas, baked->OwnerFont, src, baked, glyph, src_subpixels, ImTextureFormat_Alpha8, src_pitch, (r->w - IM_FONTBAKED_LCD_PADDING * 2) * 3, r->h };
+    ImFontAtlasTextureBlockPostProcess(&pp_data);
+    ImFontAtlasTextureBlockConvertLcd(src_subpixels, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->GetPitch(), r->w, r->h);
+    ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
+}
+
 void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
 {
     RemapPairs.SetInt((ImGuiID)from_codepoint, (int)to_codepoint);
@@ -5221,6 +6715,9 @@ void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
 // Find glyph, load if necessary, return fallback if missing
 ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 {
+    if (c < IM_ARRAYSIZE(Latin1Glyphs))
+        if (ImFontGlyph* glyph = Latin1Glyphs[c])
+            return glyph;
     if (c < (size_t)IndexLookup.Size) IM_LIKELY
     {
         const int i = (int)IndexLookup.Data[c];
@@ -5281,6 +6778,8 @@ bool ImFont::IsGlyphInFont(ImWchar c)
 IM_MSVC_RUNTIME_CHECKS_OFF
 float ImFontBaked::GetCharAdvance(ImWchar c)
 {
+    if (c < IM_ARRAYSIZE(Latin1AdvanceX) && Latin1AdvanceX[c] >= 0.0f)
+        return Latin1AdvanceX[c];
     if ((int)c < IndexAdvanceX.Size)
     {
         // Missing glyphs fitting inside index will have stored FallbackAdvanceX already.
@@ -5312,6 +6811,13 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
 
     if (density < 0.0f)
         density = CurrentRasterizerDensity;
+
+    // Signed distance field fonts use a single baked size, scaled by callers
+    if ((Flags & ImFontFlags_SDF) && ImFontAtlasFontUseSdf(OwnerAtlas, this))
+    {
+        size = IM_FONTBAKED_SDF_SIZE;
+        density = 1.0f;
+    }
     if (baked && baked->Size == size && baked->RasterizerDensity == density)
         return baked;
 
@@ -5423,7 +6929,7 @@ const char* ImFontCalcWordWrapPositionEx(ImFont* font, float size, const char* t
         }
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        float char_width = (c < IM_ARRAYSIZE(baked->Latin1AdvanceX)) ? baked->Latin1AdvanceX[c] : (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
         if (char_width < 0.0f)
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
 
@@ -5544,7 +7050,7 @@ ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wra
             continue;
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        float char_width = (c < IM_ARRAYSIZE(baked->Latin1AdvanceX)) ? baked->Latin1AdvanceX[c] : (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
         if (char_width < 0.0f)
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
         char_width *= scale;
@@ -5573,8 +7079,119 @@ ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wra
     return text_size;
 }
 
+// Lookup and store short strings in ImFontBaked::TextSizeCache (see ImFontAtlasFlags_UseTextSizeCache)
+static ImVec2 ImFontCalcTextSizeCached(ImFont* font, float size, const char* text_begin, const char* text_end)
+{
+    ImFontAtlas* atlas = font->OwnerAtlas;
+    ImFontBaked* baked = font->GetFontBaked(size);
+    const int text_len = (int)(text_end - text_begin);
+
+    // Single character (e.g. " ", "#"): same as ImFontCalcTextSizeEx() without the loop
+    if (text_len <= 4)
+    {
+        unsigned int c = (unsigned int)(unsigned char)*text_begin;
+        const int c_len = (c < 0x80) ? 1 : ImTextCharFromUtf8(&c, text_begin, text_end);
+        if (c_len == text_len && c != '\n' && c != '\r')
+        {
+            float char_width = (c < IM_ARRAYSIZE(baked->Latin1AdvanceX)) ? baked->Latin1AdvanceX[c] : (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+            if (char_width < 0.0f)
+                char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            return ImVec2(char_width * (size / baked->Size), size);
+        }
+    }
+
+    // Results using fallback advances for glyphs which may be loaded later can't be stored: don't allocate a cache for them
+    // (e.g. temporary password font which can't load glyphs).
+    if (baked->TextSizeCache == NULL)
+    {
+        if ((font->Flags & ImFontFlags_NoLoadGlyphs) || atlas->Locked)
+            return ImFontCalcTextSizeEx(font, size, FLT_MAX, -1.0f, text_begin, text_end, text_end, NULL, NULL, ImDrawTextFlags_None);
+        baked->TextSizeCache = IM_NEW(ImFontBakedTextSizeCache)();
+    }
+    ImFontBakedTextSizeCache* cache = baked->TextSizeCache;
+
+    // Short strings (e.g. " 1234 "): text bytes and length are the key, no hashing or text compare.
+    // Longer strings: lookup on hash of text.
+    ImFontBakedTextSizeCacheShortEntry* short_entry = NULL;
+    ImFontBakedTextSizeCacheEntry* entry = NULL;
+    ImU64 short_key = 0;
+    ImGuiID key = 0;
+    if (text_len <= IM_FONTBAKED_TEXT_SIZE_CACHE_SHORT_TEXT_LEN)
+    {
+        short_key = (ImU64)text_len << 56;
+        for (int n = 0; n < text_len; n++)
+            short_key |= (ImU64)(unsigned char)text_begin[n] << (n * 8);
+        short_entry = &cache->ShortEntries[(ImU32)((short_key * 0x9E3779B97F4A7C15ULL) >> (64 - IM_FONTBAKED_TEXT_SIZE_CACHE_SHORT_ENTRIES_LOG2 + 1)) * 2];
+        for (int way = 0; way < 2; way++)
+            if (short_entry[way].Key == short_key && short_entry[way].Size == size)
+            {
+                cache->HitCount++;
+                return ImVec2(short_entry[way].Width, size);
+            }
+    }
+    else
+    {
+        key = ImHashData(text_begin, (size_t)text_len);
+        if (key == 0)
+            key = 1;
+        entry = &cache->Entries.Data[key & (cache->Entries.Size - 1)];
+        if (entry->Key == key && entry->Size == size && entry->TextLen == text_len && memcmp(entry->Text, text_begin, (size_t)text_len) == 0)
+        {
+            cache->HitCount++;
+            return ImVec2(entry->Width, size);
+        }
+    }
+    cache->MissCount++;
+
+    // Measuring may load glyphs and discard this baked font's cache, so look it up again.
+    // Multi-line text is not stored.
+    ImVec2 text_size = ImFontCalcTextSizeEx(font, size, FLT_MAX, -1.0f, text_begin, text_end, text_end, NULL, NULL, ImDrawTextFlags_None);
+    if (text_size.y != size || baked->TextSizeCache != cache || baked->WantDestroy || (font->Flags & ImFontFlags_NoLoadGlyphs) || atlas->Locked)
+        return text_size;
+    if (short_entry != NULL)
+    {
+        short_entry[1] = short_entry[0];
+        short_entry->Key = short_key;
+        short_entry->Size = size;
+        short_entry->Width = text_size.x;
+    }
+    else
+    {
+        // Double the table when live entries keep replacing each other
+        if (entry->Key != 0 && ++cache->EvictCount >= cache->Entries.Size / 2 && cache->Entries.Size < IM_FONTBAKED_TEXT_SIZE_CACHE_MAX_ENTRIES)
+        {
+            ImVector<ImFontBakedTextSizeCacheEntry> old_entries;
+            old_entries.swap(cache->Entries);
+            cache->Entries.resize(old_entries.Size * 2, ImFontBakedTextSizeCacheEntry());
+            for (const ImFontBakedTextSizeCacheEntry& old_entry : old_entries)
+                if (old_entry.Key != 0)
+                    cache->Entries[old_entry.Key & (cache->Entries.Size - 1)] = old_entry;
+            cache->EvictCount = 0;
+            entry = &cache->Entries[key & (cache->Entries.Size - 1)];
+        }
+        entry->Key = key;
+        entry->Size = size;
+        entry->Width = text_size.x;
+        entry->TextLen = text_len;
+        memcpy(entry->Text, text_begin, (size_t)text_len);
+    }
+    return text_size;
+}
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** out_remaining)
 {
+    if (OwnerAtlas->Flags & ImFontAtlasFlags_UseTextSizeCache)
+    {
+        if (!text_end)
+            text_end = text_begin + ImStrlen(text_begin);
+        const int text_len = (int)(text_end - text_begin);
+        if (max_width == FLT_MAX && wrap_width <= 0.0f && text_len > 0 && text_len <= IM_FONTBAKED_TEXT_SIZE_CACHE_MAX_TEXT_LEN)
+        {
+            if (out_remaining != NULL)
+                *out_remaining = text_end;
+            return ImFontCalcTextSizeCached(this, size, text_begin, text_end);
+        }
+    }
     return ImFontCalcTextSizeEx(this, size, max_width, wrap_width, text_begin, text_end, text_end, out_remaining, NULL, ImDrawTextFlags_None);
 }
 
@@ -5613,14 +7230,33 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (y1 >= y2)
             return;
     }
+    const bool sdf_text = baked->IsSdf && (draw_list->Flags & ImDrawListFlags_AllowSdfText);
+    const bool lcd_text = baked->IsLcd && (draw_list->Flags & ImDrawListFlags_AllowLcdText);
+    const bool page_tex = (glyph->PageIndex != 0); // Multi-page atlas
+    if (page_tex)
+        draw_list->PushTexture(ImFontAtlasPackGetPageTexture(OwnerAtlas, glyph->PageIndex)->GetTexRef());
+    if (sdf_text)
+        draw_list->_BeginSdfText();
+    if (lcd_text)
+        draw_list->_BeginLcdText();
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    if (sdf_text)
+        draw_list->_EndSdfText();
+    if (lcd_text)
+        draw_list->_EndLcdText();
+    if (page_tex)
+        draw_list->PopTexture();
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 // DO NOT CALL DIRECTLY THIS WILL CHANGE WILDLY IN 2025-2025. Use ImDrawList::AddText().
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, ImDrawTextFlags flags)
 {
+    bool sdf_text_begun = false;
+    bool lcd_text_begun = false;
+    bool page_tex_pushed = false;
+
     // Align to be pixel perfect
 begin:
     float x = IM_TRUNC(pos.x);
@@ -5676,20 +7312,38 @@ begin:
     if (s == text_end)
         return;
 
+    // Signed distance field and subpixel glyphs need the backend to switch shader
+    if (baked->IsSdf && (draw_list->Flags & ImDrawListFlags_AllowSdfText) && !sdf_text_begun)
+    {
+        draw_list->_BeginSdfText();
+        sdf_text_begun = true;
+    }
+    if (baked->IsLcd && (draw_list->Flags & ImDrawListFlags_AllowLcdText) && !lcd_text_begun)
+    {
+        draw_list->_BeginLcdText();
+        lcd_text_begun = true;
+    }
+
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
-    const int vtx_count_max = (int)(text_end - s) * 4;
-    const int idx_count_max = (int)(text_end - s) * 6;
-    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    int vtx_count_max = (int)(text_end - s) * 4;
+    int idx_count_max = (int)(text_end - s) * 6;
+    int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
     draw_list->PrimReserve(idx_count_max, vtx_count_max);
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
-    const int cmd_count = draw_list->CmdBuffer.Size;
+    int cmd_count = draw_list->CmdBuffer.Size;
+    int page_n = 0; // Multi-page atlas: glyphs on other pages than 0 are rendered with their own texture
     const bool cpu_fine_clip = (flags & ImDrawTextFlags_CpuFineClip) != 0;
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
 
+    // Once past the right edge of clip_rect, the rest of a line is skipped.
+    // We allow glyphs to extend up to one line height left of their cursor position (negative X0).
+    const float clip_x_skip = clip_rect.z + line_height;
+
+
     while (s < text_end)
     {
         if (word_wrap_enabled)
@@ -5710,6 +7364,69 @@ begin:
             }
         }
 
+        // Skip to end of line when the rest of it is clipped
+        const char* line_limit = word_wrap_enabled ? word_wrap_eol : text_end;
+        if (x > clip_x_skip)
+        {
+            const char* line_end = (const char*)ImMemchr(s, '\n', line_limit - s);
+            if (line_end == NULL)
+            {
+                s = line_limit;
+                continue;
+            }
+            s = line_end;
+        }
+
+        // Fast path: run of printable Latin-1 characters with loaded glyphs, looked up in Latin1Glyphs[] without calling FindGlyph()
+        if (!cpu_fine_clip)
+        {
+            const char* run_begin = s;
+            ImFontGlyph* const* latin1_glyphs = baked->Latin1Glyphs;
+            while (s < line_limit && x <= clip_x_skip)
+            {
+                unsigned int c = (unsigned char)*s;
+                if (c < 32)
+                    break;
+                int c_len = 1;
+                if (c >= 0x80)
+                {
+                    // Decode U+0080..U+00FF (2 bytes starting with 0xC2 or 0xC3), let regular path handle anything else
+                    if ((c & 0xFE) != 0xC2 || s + 1 >= line_limit || ((unsigned char)s[1] & 0xC0) != 0x80)
+                        break;
+                    c = ((c & 0x1F) << 6) | ((unsigned char)s[1] & 0x3F);
+                    c_len = 2;
+                }
+                const ImFontGlyph* glyph = latin1_glyphs[c];
+                if (glyph == NULL || (glyph->PageIndex != page_n && glyph->Visible))
+                    break;
+                s += c_len;
+
+                if (glyph->Visible)
+                {
+                    const float x1 = x + glyph->X0 * scale;
+                    const float x2 = x + glyph->X1 * scale;
+                    if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+                    {
+                        const ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+                        const float y1 = y + glyph->Y0 * scale;
+                        const float y2 = y + glyph->Y1 * scale;
+                        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = glyph->U0; vtx_write[0].uv.y = glyph->V0;
+                        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = glyph->U1; vtx_write[1].uv.y = glyph->V0;
+                        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = glyph->U1; vtx_write[2].uv.y = glyph->V1;
+                        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = glyph->U0; vtx_write[3].uv.y = glyph->V1;
+                        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+                        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+                        vtx_write += 4;
+                        vtx_index += 4;
+                        idx_write += 6;
+                    }
+                }
+                x += glyph->AdvanceX * scale;
+            }
+            if (s != run_begin)
+                continue;
+        }
+
         // Decode and advance source
         unsigned int c = (unsigned int)*s;
         if (c < 0x80)
@@ -5781,6 +7498,33 @@ begin:
                     }
                 }
 
+                // Multi-page atlas: submit vertices written so far, switch texture and reserve again for remaining characters.
+                if (glyph->PageIndex != page_n && cmd_count == draw_list->CmdBuffer.Size)
+                {
+                    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data);
+                    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+                    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+                    draw_list->_VtxWritePtr = vtx_write;
+                    draw_list->_IdxWritePtr = idx_write;
+                    draw_list->_VtxCurrentIdx = vtx_index;
+                    page_n = glyph->PageIndex;
+                    ImTextureRef page_tex_ref = ImFontAtlasPackGetPageTexture(OwnerAtlas, page_n)->GetTexRef();
+                    if (page_tex_pushed)
+                        draw_list->_SetTexture(page_tex_ref);
+                    else
+                        draw_list->PushTexture(page_tex_ref);
+                    page_tex_pushed = true;
+
+                    vtx_count_max = (int)(text_end - s + 1) * 4;
+                    idx_count_max = (int)(text_end - s + 1) * 6;
+                    idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+                    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+                    vtx_write = draw_list->_VtxWritePtr;
+                    idx_write = draw_list->_IdxWritePtr;
+                    vtx_index = draw_list->_VtxCurrentIdx;
+                    cmd_count = draw_list->CmdBuffer.Size;
+                }
+
                 // Support for untinted glyphs
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
@@ -5804,10 +7548,14 @@ begin:
     // Edge case: calling RenderText() with unloaded glyphs triggering texture change. It doesn't happen via ImGui:: calls because CalcTextSize() is always used.
     if (cmd_count != draw_list->CmdBuffer.Size) //-V547
     {
+        // (with a multi-page atlas, textures are never replaced while loading glyphs, so we don't need to undo page switches)
         IM_ASSERT(draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount == 0);
         draw_list->CmdBuffer.pop_back();
         draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
         draw_list->AddDrawCmd();
+        if (page_tex_pushed)
+            draw_list->PopTexture();
+        page_tex_pushed = false;
         //IMGUI_DEBUG_LOG("RenderText: cancel and retry to missing glyphs.\n"); // [DEBUG]
         //draw_list->AddRectFilled(pos, pos + ImVec2(10, 10), IM_COL32(255, 0, 0, 255)); // [DEBUG]
         goto begin;
@@ -5822,6 +7570,12 @@ begin:
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_index;
+    if (page_tex_pushed)
+        draw_list->PopTexture();
+    if (sdf_text_begun)
+        draw_list->_EndSdfText();
+    if (lcd_text_begun)
+        draw_list->_EndLcdText();
 }
 
 //-----------------------------------------------------------------------------
@@ -6055,6 +7809,7 @@ static void stb__match(const unsigned char *data, unsigned int length)
     IM_ASSERT(stb__dout + length <= stb__barrier_out_e);
     if (stb__dout + length > stb__barrier_out_e) { stb__dout += length; return; }
     if (data < stb__barrier_out_b) { stb__dout = stb__barrier_out_e+1; return; }
+    if (stb__dout - data >= (ptrdiff_t)length) { memcpy(stb__dout, data, length); stb__dout += length; return; } // Non-overlapping: plain copy
     while (length--) *stb__dout++ = *data++;
 }
 
@@ -6336,10 +8091,24 @@ static const unsigned char proggy_clean_ttf_compressed_data[9583] =
     239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,35,57,102,0,0,5,250,72,249,98,247,
 };
 
-static const char* GetDefaultCompressedFontDataTTF(int* out_size)
+// Decompressed once into static storage, then shared by all atlases/contexts: no heap allocation and no work on subsequent calls.
+// We use a plain flag rather than a function-local static initializer, to avoid pulling in compiler guards (__cxa_guard_acquire etc.).
+// Like the rest of the atlas API, this is not thread-safe: don't call AddFontDefault() for the first time from multiple threads at once.
+static unsigned char proggy_clean_ttf_data[41208];
+static bool proggy_clean_ttf_decompressed = false;
+
+static const void* GetDefaultFontDataTTF(int* out_size)
 {
-    *out_size = proggy_clean_ttf_compressed_size;
-    return (const char*)proggy_clean_ttf_compressed_data;
+    if (!proggy_clean_ttf_decompressed)
+    {
+        IM_ASSERT(stb_decompress_length(proggy_clean_ttf_compressed_data) == sizeof(proggy_clean_ttf_data));
+        unsigned int decompressed_size = stb_decompress(proggy_clean_ttf_data, proggy_clean_ttf_compressed_data, proggy_clean_ttf_compressed_size);
+        IM_ASSERT(decompressed_size == sizeof(proggy_clean_ttf_data));
+        IM_UNUSED(decompressed_size);
+        proggy_clean_ttf_decompressed = true;
+    }
+    *out_size = (int)sizeof(proggy_clean_ttf_data);
+    return proggy_clean_ttf_data;
 }
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FONT
 
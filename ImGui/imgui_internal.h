@@ -63,6 +63,12 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
+#if defined __AVX2__
+#define IMGUI_ENABLE_AVX2
+#endif
 #if (defined __AVX__ || defined __SSE4_2__)
 #define IMGUI_ENABLE_SSE4_2
 #include <nmmintrin.h>
@@ -72,6 +78,10 @@ Index of this file:
 #if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
 #endif
+// IMGUI_USE_FAST_ID_HASH is ignored when SSE 4.2 CRC32 instructions are available: they are faster and have fewer collisions.
+#if defined(IMGUI_USE_FAST_ID_HASH) && !defined(IMGUI_ENABLE_SSE4_2_CRC)
+#define IMGUI_ENABLE_FAST_ID_HASH
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -137,11 +147,15 @@ Index of this file:
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
+struct ImGuiTextIndexFilter;        // Maintain the list of lines of a ImGuiTextIndex passing a ImGuiTextFilter.
 
 // ImDrawList/ImFontAtlas
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
+struct ImFontAtlasGlyphCache;       // Rasterized glyphs saved/loaded across sessions
+struct ImFontAtlasGlyphJob;         // Glyph being rasterized on another thread
+struct ImFontAtlasPage;             // Additional texture page of a multi-page atlas
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
 struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
 
@@ -180,6 +194,7 @@ struct ImGuiTableInstanceData;      // Storage for one instance of a same table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiThreadedDrawList;       // Storage for a draw list recorded on another thread, see AddThreadedDrawList()
 struct ImGuiTreeNodeStackData;      // Temporary storage for TreeNode().
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
@@ -381,6 +396,11 @@ inline bool             ImIsPowerOfTwo(int v)               { return v != 0 && (
 inline bool             ImIsPowerOfTwo(ImU64 v)             { return v != 0 && (v & (v - 1)) == 0; }
 inline int              ImUpperPowerOfTwo(int v)            { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 inline unsigned int     ImCountSetBits(unsigned int v)      { unsigned int count = 0; while (v > 0) { v = v & (v - 1); count++; } return count; }
+#if defined(__GNUC__) || defined(__clang__)
+inline unsigned int     ImCountTrailingZeroes(unsigned int v) { return (unsigned int)__builtin_ctz(v); } // v must be non-zero
+#else
+inline unsigned int     ImCountTrailingZeroes(unsigned int v) { unsigned int count = 0; while ((v & 1) == 0) { v >>= 1; count++; } return count; }
+#endif
 
 // Helpers: String
 #define ImStrlen strlen
@@ -813,6 +833,23 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: Incrementally maintain the list of lines of a ImGuiTextIndex which pass a ImGuiTextFilter.
+// Call update() every frame: only lines appended since the last call are tested (+ the last line, which may have grown),
+// unless the filter changed. Then use with ImGuiListClipper: clipper.Begin(filtered.size()), line_no = filtered.get_line_no(n).
+// Call clear() when clearing the text buffer and its index.
+struct ImGuiTextIndexFilter
+{
+    ImVector<int>   LineNos;                                // Lines passing the filter (unused when the filter is inactive)
+    int             SrcLinesCount = 0;                      // Number of ImGuiTextIndex lines already tested
+    ImGuiID         FilterHash = 0;                         // Hash of ImGuiTextFilter::InputBuf used to test lines
+    bool            FilterActive = false;
+
+    void            clear()                                 { LineNos.clear(); SrcLinesCount = 0; }
+    int             size() const                            { return FilterActive ? LineNos.Size : SrcLinesCount; }
+    int             get_line_no(int n) const                { return FilterActive ? LineNos[n] : n; }
+    IMGUI_API void  update(const ImGuiTextFilter& filter, ImGuiTextIndex& index, const char* base);
+};
+
 // Helper: ImGuiStorage
 IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_end, ImGuiID key);
 
@@ -876,6 +913,17 @@ struct IMGUI_API ImDrawListSharedData
     void SetCircleTessellationMaxError(float max_error);
 };
 
+// Storage for ImGui::AddThreadedDrawList()
+struct ImGuiThreadedDrawList
+{
+    ImDrawList*             DrawList;
+    ImDrawListSharedData    SharedData;                         // Copy of the context's shared data used while recording, so main thread atlas updates can't race with it
+    ImVec4                  TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+    bool                    Recording;                          // Set by AddThreadedDrawList(), cleared when given back to the context in Render()
+
+    ImGuiThreadedDrawList() { DrawList = NULL; Recording = false; }
+};
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>*  Layers[2];      // Pointers to global layers for: regular, tooltip. LayersP[0] is owned by DrawData.
@@ -2199,6 +2247,9 @@ struct ImGuiContext
     float                   FontRasterizerDensity;              // Current font density. Used by all calls to GetFontBaked().
     float                   CurrentDpiScale;                    // Current window/viewport DpiScale == CurrentViewport->DpiScale
     ImDrawListSharedData    DrawListSharedData;
+    ImVector<ImGuiThreadedDrawList*> ThreadedDrawLists;         // Pool of entries for AddThreadedDrawList()
+    int                     ThreadedDrawListsCount;             // Entries used this frame
+    bool                    ThreadedDrawListsRecording;         // Set between the first AddThreadedDrawList() and Render(). Allocations aren't recorded in DebugAllocInfo meanwhile, as workers may allocate concurrently.
     ImGuiID                 WithinEndChildID;                   // Set within EndChild()
     void*                   TestEngine;                         // Test engine user data
 
@@ -2524,6 +2575,8 @@ struct ImGuiContext
     ImGuiDebugLogFlags      DebugLogFlags;
     ImGuiTextBuffer         DebugLogBuf;
     ImGuiTextIndex          DebugLogIndex;
+    ImGuiTextFilter         DebugLogFilter;
+    ImGuiTextIndexFilter    DebugLogIndexFilter;
     int                     DebugLogSkippedErrors;
     ImGuiDebugLogFlags      DebugLogAutoDisableFlags;
     ImU8                    DebugLogAutoDisableFrames;
@@ -2604,6 +2657,7 @@ struct IMGUI_API ImGuiWindowTempData
     ImU32                   TreeHasStackDataDepthMask;      // Store whether given depth has ImGuiTreeNodeStackData data. Could be turned into a ImU64 if necessary.
     ImU32                   TreeRecordsClippedNodesY2Mask;  // Store whether we should keep recording Y2. Cleared when passing clip max. Equivalent TreeHasStackDataDepthMask value should always be set.
     ImVector<ImGuiWindow*>  ChildWindows;
+    ImVector<ImDrawList*>   ThreadedDrawLists;      // Added with AddThreadedDrawList() this frame, rendered after DrawList in call order
     ImGuiStorage*           StateStorage;           // Current persistent per-window storage (store e.g. tree node open/close state)
     ImGuiOldColumns*        CurrentColumns;         // Current columns set
     int                     CurrentTableIdx;        // Current table index (into g.Tables)
@@ -3769,9 +3823,24 @@ struct ImFontLoader
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
     size_t          FontBakedSrcLoaderDataSize;
 
+    // Capabilities
+    bool            HasSdf;         // Can output signed distance fields when ImFontBaked::IsSdf is set (see ImFontFlags_SDF).
+    bool            HasLcd;         // Can output per-subpixel coverage when ImFontBaked::IsLcd is set (see ImFontFlags_LCD, ImFontAtlasBakedSetFontGlyphBitmapLcd()).
+
     ImFontLoader()  { memset(this, 0, sizeof(*this)); }
 };
 
+// Fonts using ImFontFlags_SDF have a single baked size, scaled at render time.
+// Distance to glyph edges is stored over +/- IM_FONTBAKED_SDF_SPREAD pixels (at baked size), with 0.5 (128) on edges.
+#ifndef IM_FONTBAKED_SDF_SIZE
+#define IM_FONTBAKED_SDF_SIZE       32.0f
+#endif
+#define IM_FONTBAKED_SDF_SPREAD     4
+
+// Fonts using ImFontFlags_LCD are rasterized with 3 horizontal samples per pixel (one per R/G/B subpixel).
+// Coverage is filtered over 5 subpixels to reduce color fringes, which widens glyphs by IM_FONTBAKED_LCD_PADDING pixel on each side.
+#define IM_FONTBAKED_LCD_PADDING    1
+
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 IMGUI_API const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype();
 #endif
@@ -3811,6 +3880,19 @@ struct ImFontAtlasRectEntry
     unsigned int        IsUsed : 1;
 };
 
+// Texture page of a multi-page atlas (see ImFontAtlas::TexPageSize). Pages are never resized nor repacked: glyphs which don't fit go to a new page.
+// Packer state of the page currently packed into lives in ImFontAtlasBuilder::PackXXX fields, see ImFontAtlasPackSetCurrentPage().
+#define IM_FONTATLAS_PAGES_MAX      32      // Limited by ImFontGlyph::PageIndex bits
+struct ImFontAtlasPage
+{
+    ImTextureData*              Tex;                    // NULL for page 0, which is ImFontAtlas::TexData.
+    ImVector<ImVec2i>           PackSkyline;            // Stored packer state (when not current page)
+    ImVector<ImTextureRect>     PackFreeRects;
+    int                         PackFreeSurface;
+
+    ImFontAtlasPage()           { Tex = NULL; PackFreeSurface = 0; }
+};
+
 // Data available to potential texture post-processing functions
 struct ImFontAtlasPostProcessData
 {
@@ -3828,23 +3910,139 @@ struct ImFontAtlasPostProcessData
     int                 Height;
 };
 
-// We avoid dragging imstb_rectpack.h into public header (partly because binding generators are having issues with it)
-#ifdef IMGUI_STB_NAMESPACE
-namespace IMGUI_STB_NAMESPACE { struct stbrp_node; }
-typedef IMGUI_STB_NAMESPACE::stbrp_node stbrp_node_im;
-#else
-struct stbrp_node;
-typedef stbrp_node stbrp_node_im;
-#endif
-struct stbrp_context_opaque { char data[80]; };
+// Cache of widths returned by ImFont::CalcTextSizeA() for short strings, one per ImFontBaked (see ImFontAtlasFlags_UseTextSizeCache).
+// - Single characters are not cached: their advance is read directly (e.g. " ", "#").
+// - Strings up to 7 bytes are packed with their length into a 64-bit key, so a lookup is one or two compares (e.g. " 1234 ").
+//   2-way set associative: a new string moves the previous one of its set to the second way, replacing the older one.
+// - Longer strings are looked up on text hash. Text is stored to verify hits. Direct-mapped: a colliding string replaces
+//   the previous one. The table starts small and doubles when entries keep replacing each other.
+// - Only single line measurements without wrapping or maximum width are cached (height is always the font size).
+//   Cleared when a glyph of the baked font is discarded.
+#define IM_FONTBAKED_TEXT_SIZE_CACHE_SHORT_TEXT_LEN 7       // Strings up to this length use ShortEntries[]
+#define IM_FONTBAKED_TEXT_SIZE_CACHE_SHORT_ENTRIES_LOG2 8    // 256 entries in 128 sets of 2
+#define IM_FONTBAKED_TEXT_SIZE_CACHE_SHORT_ENTRIES  (1 << IM_FONTBAKED_TEXT_SIZE_CACHE_SHORT_ENTRIES_LOG2)
+#define IM_FONTBAKED_TEXT_SIZE_CACHE_MAX_TEXT_LEN   40
+#define IM_FONTBAKED_TEXT_SIZE_CACHE_MIN_ENTRIES    64      // Must be a power of two
+#define IM_FONTBAKED_TEXT_SIZE_CACHE_MAX_ENTRIES    512     // Must be a power of two
+struct ImFontBakedTextSizeCacheShortEntry
+{
+    ImU64               Key;                // Text bytes and length, 0 for empty entry
+    float               Size;
+    float               Width;
+};
+
+struct ImFontBakedTextSizeCacheEntry
+{
+    ImGuiID             Key;                // Hash of text, 0 for empty entry
+    float               Size;
+    float               Width;
+    int                 TextLen;
+    char                Text[IM_FONTBAKED_TEXT_SIZE_CACHE_MAX_TEXT_LEN];
+
+    ImFontBakedTextSizeCacheEntry()         { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImFontBakedTextSizeCache
+{
+    ImFontBakedTextSizeCacheShortEntry ShortEntries[IM_FONTBAKED_TEXT_SIZE_CACHE_SHORT_ENTRIES];
+    ImVector<ImFontBakedTextSizeCacheEntry> Entries;
+    int                 EvictCount;         // Number of entries replaced since last growth
+    int                 HitCount;           // Statistics, displayed in Metrics
+    int                 MissCount;
+
+    ImFontBakedTextSizeCache()              { memset(ShortEntries, 0, sizeof(ShortEntries)); Entries.resize(IM_FONTBAKED_TEXT_SIZE_CACHE_MIN_ENTRIES, ImFontBakedTextSizeCacheEntry()); EvictCount = HitCount = MissCount = 0; }
+};
+
+// Rasterization of a glyph on another thread, see ImFontAtlas::GlyphJobDispatchFunc.
+// - Created by the font loader while loading a glyph: the glyph is added with its final metrics and texture rectangle, but marked not Visible.
+// - The worker only accesses the job and immutable font data. It writes into Pixels[] which is allocated by the main thread.
+// - Completed jobs are copied into the texture by ImFontAtlasUpdateNewFrame(). The glyph is then looked up again, so discarding it meanwhile is safe.
+enum ImFontAtlasGlyphJobState_
+{
+    ImFontAtlasGlyphJobState_Queued,
+    ImFontAtlasGlyphJobState_Running,
+    ImFontAtlasGlyphJobState_Done,
+};
+
+struct ImFontAtlasGlyphJob
+{
+    int                 State;              // ImFontAtlasGlyphJobState_. Only accessed with atomic operations.
+    ImFont*             Font;
+    ImGuiID             BakedId;            // Baked font may be discarded or moved while the job is running
+    ImFontAtlasRectId   PackId;
+    int                 GlyphIndexHint;     // Index in ImFontBaked::Glyphs[] when created, verified using PackId
+    int                 Width, Height;
+    ImVector<unsigned char> Pixels;         // Output of RunGlyphJob(), ImTextureFormat_Alpha8, Width*Height, cleared when created
+    void                (*RasterizeFunc)(const ImFontAtlasGlyphJob* job, unsigned char* out_pixels); // Set by font loader. May be called on any thread.
+    void*               LoaderData;         // Font loader data for the source, valid until all jobs of the font are done (see ImFontAtlasFontDestroyOutput)
+    int                 LoaderGlyphIndex;
+    float               LoaderScaleX, LoaderScaleY;
+    int                 LoaderOversampleH, LoaderOversampleV;
+
+    ImFontAtlasGlyphJob()   { memset(this, 0, sizeof(*this)); PackId = ImFontAtlasRectId_Invalid; }
+};
+
+// Persistent glyph cache, see ImFontAtlas::LoadGlyphCacheFromDisk()
+// File layout: ImFontAtlasGlyphCacheHeader, then for each baked font: ImFontAtlasGlyphCacheEntry, glyphs, pixels (padded to 4 bytes).
+#define IM_FONTATLAS_GLYPHCACHE_VERSION     1
+
+struct ImFontAtlasGlyphCacheHeader
+{
+    char                Magic[4];           // "IMGC"
+    ImU32               Version;            // IM_FONTATLAS_GLYPHCACHE_VERSION (also used to detect endianness mismatch)
+    ImU32               ImGuiVersionNum;    // IMGUI_VERSION_NUM, as rasterization or metrics may change between versions
+    int                 EntriesCount;
+};
+
+struct ImFontAtlasGlyphCacheEntry
+{
+    ImGuiID             Key;                // Hash of font data, sources config, size, density, loader and loader flags. See ImFontAtlasGlyphCacheGetBakedKey().
+    int                 GlyphsCount;
+    int                 PixelsFormat;       // ImTextureFormat
+    int                 PixelsSize;         // Size of pixel data following glyphs, including padding
+};
+
+struct ImFontAtlasGlyphCacheGlyph
+{
+    unsigned int        Colored : 1;        // Same as ImFontGlyph
+    unsigned int        Visible : 1;
+    unsigned int        SourceIdx : 4;
+    unsigned int        Codepoint : 26;
+    float               AdvanceX;           // Final metrics, as stored in ImFontGlyph (clamping, snapping and offsets already applied)
+    float               X0, Y0, X1, Y1;
+    unsigned short      Width, Height;      // Bitmap size, 0 for glyphs without pixels
+    int                 PixelsOffset;       // Offset in entry's pixel data
+};
+
+struct ImFontAtlasGlyphCache
+{
+    ImVector<char>      Data;               // Loaded (or last saved) file contents
+    ImGuiStorage        EntriesMap;         // Key -> Offset in Data[] + 1
+    int                 BakedLoadedCount;   // Statistics, displayed in Metrics
+    int                 GlyphsLoadedCount;
+
+    ImFontAtlasGlyphCache() { BakedLoadedCount = GlyphsLoadedCount = 0; }
+};
 
 // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasBuilder
 {
-    stbrp_context_opaque        PackContext;            // Actually 'stbrp_context' but we don't want to define this in the header file.
-    ImVector<stbrp_node_im>     PackNodes;
+    ImVector<ImVec2i>           PackSkyline;            // Skyline nodes sorted by x. Each spans from x to next node (or texture width), pixels from y downward are free.
+    ImVector<ImTextureRect>     PackFreeRects;          // Free space below the skyline left by discarded rectangles, including padding. Pixels are cleared when space is reused.
+    int                         PackFreeSurface;        // Sum of PackFreeRects[] areas.
+    int                         PackDefragBandY;        // When > 0: ImFontAtlasTextureDefrag() is moving rectangles out of the texture band below this, packing happens above it.
+    int                         PackDefragBandSkipped;  // Number of glyphs in band which didn't fit above it
+    int                         PackDefragBandMoved;    // Number of glyphs moved out of band
+    int                         PackDefragPrevBandY;    // Top of previous band, next one is above it. 0 to start from the bottom of texture.
+    bool                        PackDefragIdle;         // Set when ImFontAtlasTextureDefrag() had nothing to do, until next released space.
+    int                         PackDefragMovedCount;   // Statistics, displayed in Metrics
+    ImVector<ImFontGlyph*>      PackDefragGlyphs;       // Scratch buffers for ImFontAtlasTextureDefrag()
+    ImVector<ImTextureRect>     PackDefragRects;
     ImVector<ImTextureRect>     Rects;
     ImVector<ImFontAtlasRectEntry> RectsIndex;          // ImFontAtlasRectId -> index into Rects[]
+    ImVector<ImFontAtlasPage>   Pages;                  // Multi-page atlas only (empty otherwise). Pages[0] is ImFontAtlas::TexData.
+    ImVector<ImU8>              RectsPage;              // Multi-page atlas only: page index of each Rects[] entry.
+    int                         PagesCurrent;           // Page which packer state is held in PackXXX fields.
     ImVector<unsigned char>     TempBuffer;             // Misc scratch buffer
     int                         RectsIndexFreeListStart;// First unused entry
     int                         RectsPackedCount;       // Number of packed rectangles.
@@ -3856,6 +4054,7 @@ struct ImFontAtlasBuilder
     ImVec2i                     MaxRectBounds;          // Bottom-right most used pixels
     bool                        LockDisableResize;      // Disable resizing texture
     bool                        PreloadedAllGlyphsRanges; // Set when missing ImGuiBackendFlags_RendererHasTextures features forces atlas to preload everything.
+    bool                        PreloadingGlyphs;       // Set during ImFontAtlasBuildLegacyPreloadAllGlyphRanges(), which waits for glyph jobs before returning.
 
     // Cache of all ImFontBaked
     ImStableVector<ImFontBaked,32> BakedPool;
@@ -3866,6 +4065,10 @@ struct ImFontAtlasBuilder
     ImFontAtlasRectId           PackIdMouseCursors;     // White pixel + mouse cursors. Also happen to be fallback in case of packing failure.
     ImFontAtlasRectId           PackIdLinesTexData;
 
+    // Glyphs being rasterized on other threads
+    ImVector<ImFontAtlasGlyphJob*> GlyphJobs;
+    int                         GlyphJobsCompletedCount; // Statistics, displayed in Metrics
+
     ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; }
 };
 
@@ -3878,11 +4081,23 @@ IMGUI_API void              ImFontAtlasBuildUpdatePointers(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildRenderBitmapFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char);
 IMGUI_API void              ImFontAtlasBuildClear(ImFontAtlas* atlas); // Clear output and custom rects
 
+IMGUI_API ImFontAtlasGlyphJob* ImFontAtlasBuildAddGlyphJob(ImFontAtlas* atlas, ImFontBaked* baked, ImFontAtlasRectId pack_id, int w, int h); // Return NULL when glyphs should be rasterized immediately
+IMGUI_API void              ImFontAtlasBuildDispatchGlyphJob(ImFontAtlas* atlas, ImFontAtlasGlyphJob* job);
+IMGUI_API void              ImFontAtlasBuildUpdateGlyphJobs(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasBuildFinishGlyphJobs(ImFontAtlas* atlas);                         // Wait for all jobs and apply their results
+IMGUI_API void              ImFontAtlasBuildFlushGlyphJob(ImFontAtlas* atlas, ImFontAtlasRectId pack_id);  // Rasterize a pending glyph now
+IMGUI_API void              ImFontAtlasBuildWaitGlyphJobs(ImFontAtlas* atlas, ImFont* font);             // Wait for jobs of a font (all fonts if NULL) and drop their results
+
+IMGUI_API ImGuiID           ImFontAtlasGlyphCacheGetBakedKey(ImFontAtlas* atlas, ImFontBaked* baked);   // Return 0 if baked font can't be cached
+IMGUI_API void              ImFontAtlasGlyphCacheLoadBaked(ImFontAtlas* atlas, ImFontBaked* baked);     // Add glyphs stored in cache for this baked font
+
 IMGUI_API ImTextureData*    ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h);
-IMGUI_API void              ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas);
+IMGUI_API bool              ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas, int w, int h);          // Return false if no space can be made (e.g. out of pages)
 IMGUI_API void              ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h);
 IMGUI_API void              ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_w = -1, int old_h = -1);
+IMGUI_API bool              ImFontAtlasTextureAddPage(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasTextureCompact(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasTextureDefrag(ImFontAtlas* atlas, int max_pixels);
 IMGUI_API ImVec2i           ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas);
 
 IMGUI_API void              ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
@@ -3896,6 +4111,8 @@ IMGUI_API void              ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas,
 IMGUI_API bool              ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font); // Using FontDestroyOutput/FontInitOutput sequence useful notably if font loader params have changed
 IMGUI_API void              ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font);
 IMGUI_API void              ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFont* font, int unused_frames);
+IMGUI_API bool              ImFontAtlasFontUseSdf(ImFontAtlas* atlas, ImFont* font);   // Font has ImFontFlags_SDF, and both renderer and font loaders support it
+IMGUI_API bool              ImFontAtlasFontUseLcd(ImFontAtlas* atlas, ImFont* font);   // Font has ImFontFlags_LCD, and renderer, texture format and font loaders support it
 
 IMGUI_API ImGuiID           ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
@@ -3906,11 +4123,15 @@ IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImF
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
 IMGUI_API void              ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph);
 IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch);
+IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmapLcd(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, unsigned char* src_subpixels, int src_pitch);
 
 IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
-IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL);
+IMGUI_API void              ImFontAtlasPackSetCurrentPage(ImFontAtlas* atlas, int page_n);
+IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL, bool main_page_only = false);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API int               ImFontAtlasPackGetRectPage(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API ImTextureData*    ImFontAtlasPackGetPageTexture(ImFontAtlas* atlas, int page_n);
 IMGUI_API void              ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 
 IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures);
@@ -3920,6 +4141,7 @@ IMGUI_API void              ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atla
 IMGUI_API void              ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas);
 
 IMGUI_API void              ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h);
+IMGUI_API void              ImFontAtlasTextureBlockConvertLcd(const unsigned char* src_subpixels, int src_pitch, unsigned char* dst_pixels, int dst_pitch, int w, int h);
 IMGUI_API void              ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data);
 IMGUI_API void              ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data, float multiply_factor);
 IMGUI_API void              ImFontAtlasTextureBlockFill(ImTextureData* dst_tex, int dst_x, int dst_y, int w, int h, ImU32 col);
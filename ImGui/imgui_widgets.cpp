@@ -4379,6 +4379,12 @@ void ImGui::PushPasswordFont()
     backup->FallbackAdvanceX = g.FontBaked->FallbackAdvanceX;
     backup->IndexLookup.swap(g.FontBaked->IndexLookup);
     backup->IndexAdvanceX.swap(g.FontBaked->IndexAdvanceX);
+    for (int n = 0; n < IM_ARRAYSIZE(backup->Latin1Glyphs); n++)
+    {
+        ImSwap(backup->Latin1AdvanceX[n], g.FontBaked->Latin1AdvanceX[n]);
+        ImSwap(backup->Latin1Glyphs[n], g.FontBaked->Latin1Glyphs[n]);
+    }
+    ImSwap(backup->TextSizeCache, g.FontBaked->TextSizeCache);
     g.Font->Flags |= ImFontFlags_NoLoadGlyphs;
     g.FontBaked->FallbackGlyphIndex = g.FontBaked->Glyphs.index_from_ptr(glyph);
     g.FontBaked->FallbackAdvanceX = glyph->AdvanceX;
@@ -4393,6 +4399,14 @@ void ImGui::PopPasswordFont()
     g.FontBaked->FallbackAdvanceX = backup->FallbackAdvanceX;
     g.FontBaked->IndexLookup.swap(backup->IndexLookup);
     g.FontBaked->IndexAdvanceX.swap(backup->IndexAdvanceX);
+    for (int n = 0; n < IM_ARRAYSIZE(backup->Latin1Glyphs); n++)
+    {
+        ImSwap(backup->Latin1AdvanceX[n], g.FontBaked->Latin1AdvanceX[n]);
+        ImSwap(backup->Latin1Glyphs[n], g.FontBaked->Latin1Glyphs[n]);
+    }
+    IM_ASSERT(g.FontBaked->TextSizeCache == NULL); // Not allocated while font can't load glyphs
+    g.FontBaked->TextSizeCache = backup->TextSizeCache;
+    backup->TextSizeCache = NULL;
     IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
 }
 
@@ -8459,7 +8473,7 @@ bool ImGuiSelectionBasicStorage::GetNextSelectedItem(void** opaque_it, ImGuiID*
     ImGuiStoragePair* it = (ImGuiStoragePair*)*opaque_it;
     ImGuiStoragePair* it_end = _Storage.Data.Data + _Storage.Data.Size;
     if (PreserveOrder && it == NULL && it_end != NULL)
-        ImQsort(_Storage.Data.Data, (size_t)_Storage.Data.Size, sizeof(ImGuiStoragePair), PairComparerByValueInt); // ~ImGuiStorage::BuildSortByValueInt()
+        ImQsort(_Storage.Data.Data, (size_t)_Storage.Data.Size, sizeof(ImGuiStoragePair), PairComparerByValueInt); // ~ImGuiStorage::BuildSortByValueInt(). IMGUI_USE_HASHED_STORAGE lookups detect the reorder.
     if (it == NULL)
         it = _Storage.Data.Data;
     IM_ASSERT(it >= _Storage.Data.Data && it <= it_end);
@@ -8485,6 +8499,14 @@ void ImGuiSelectionBasicStorage::SetItemSelected(ImGuiID id, bool selected)
 static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicStorage* selection, ImGuiID id, bool selected, int size_before_amends, int selection_order)
 {
     ImGuiStorage* storage = &selection->_Storage;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    // Hashed storage has O(1) insertion: no need to append unsorted and rely on ImLowerBound() over the sorted part.
+    IM_UNUSED(size_before_amends);
+    if (selected == (storage->GetInt(id, 0) != 0))
+        return;
+    storage->SetInt(id, selected ? selection_order : 0);
+    selection->Size += selected ? +1 : -1;
+#else
     ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + size_before_amends, id);
     const bool is_contained = (it != storage->Data.Data + size_before_amends) && (it->key == id);
     if (selected == (is_contained && it->val_i != 0))
@@ -8494,6 +8516,7 @@ static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicS
     else if (is_contained)
         it->val_i = selected ? selection_order : 0; // Modify in-place.
     selection->Size += selected ? +1 : -1;
+#endif
 }
 
 static void ImGuiSelectionBasicStorage_BatchFinish(ImGuiSelectionBasicStorage* selection, bool selected, int size_before_amends)
@@ -0,0 +1,125 @@
+// dear imgui
+// (command line tool: benchmark ImDrawList tessellation and text rendering)
+
+// Measures the CPU cost of building ImDrawList geometry for typical shapes and text, in microseconds per frame (best of several runs).
+// Build it with and without SIMD to compare code paths:
+//   g++ -O2 -std=c++11 -I../.. imgui_draw_bench.cpp ../../imgui*.cpp -o imgui_draw_bench
+//   g++ -O2 -std=c++11 -mavx2 -I../.. imgui_draw_bench.cpp ../../imgui*.cpp -o imgui_draw_bench_avx2
+//   g++ -O2 -std=c++11 -I../.. -DIMGUI_DISABLE_SSE imgui_draw_bench.cpp ../../imgui*.cpp -o imgui_draw_bench_scalar
+// Only uses public API, so it can be run against older versions to compare.
+
+#include "imgui.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+static double GetTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct Bench
+{
+    ImDrawList*         DrawList;
+    std::vector<ImVec2> Points;
+    std::vector<ImVec2> Star;   // Concave, AddConcavePolyFilled() is O(N^2)
+
+    void Begin(ImDrawListFlags flags)
+    {
+        DrawList->_ResetForNewFrame();
+        DrawList->Flags = flags;
+        DrawList->PushTexture(ImGui::GetIO().Fonts->TexRef);
+        DrawList->PushClipRectFullScreen();
+    }
+
+    template<typename FUNC>
+    void Run(const char* name, ImDrawListFlags flags, FUNC func)
+    {
+        double best = 1e30;
+        for (int run = 0; run < 7; run++)
+        {
+            const int frames = 200;
+            double t0 = GetTime();
+            for (int frame = 0; frame < frames; frame++)
+            {
+                Begin(flags);
+                func(DrawList, Points);
+            }
+            double t = (GetTime() - t0) / frames;
+            if (t < best)
+                best = t;
+        }
+        printf("%-48s %8.1f us/frame (%d vtx, %d idx)\n", name, best * 1e6, DrawList->VtxBuffer.Size, DrawList->IdxBuffer.Size);
+    }
+};
+
+int main(int, char**)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    ImGui::NewFrame();
+
+    Bench bench;
+    bench.DrawList = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+
+    // A wobbly closed curve with 1000 points (~2 px segments), similar to a plot line or a large circle
+    for (int n = 0; n < 1000; n++)
+    {
+        const float a = (float)n / 1000.0f * 2.0f * 3.14159265f;
+        const float r = 300.0f + 20.0f * sinf(a * 17.0f);
+        bench.Points.push_back(ImVec2(960.0f + cosf(a) * r, 540.0f + sinf(a) * r));
+    }
+    for (int n = 0; n < 64; n++)
+    {
+        const float a = (float)n / 64.0f * 2.0f * 3.14159265f;
+        const float r = (n & 1) ? 100.0f : 300.0f;
+        bench.Star.push_back(ImVec2(960.0f + cosf(a) * r, 540.0f + sinf(a) * r));
+    }
+
+    const ImDrawListFlags aa_all = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill;
+    const ImDrawListFlags aa_no_tex = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill;
+    const ImU32 col = IM_COL32(255, 200, 100, 255);
+    printf("ImDrawList tessellation, 1000 points per shape, x10 shapes per frame\n");
+    bench.Run("AddPolyline(), 1 px, AA (texture)", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>& pts) { for (int n = 0; n < 10; n++) dl->AddPolyline(pts.data(), (int)pts.size(), col, ImDrawFlags_None, 1.0f); });
+    bench.Run("AddPolyline(), 1 px, AA (no texture)", aa_no_tex, [&](ImDrawList* dl, const std::vector<ImVec2>& pts) { for (int n = 0; n < 10; n++) dl->AddPolyline(pts.data(), (int)pts.size(), col, ImDrawFlags_None, 1.0f); });
+    bench.Run("AddPolyline(), 4 px, AA, closed", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>& pts) { for (int n = 0; n < 10; n++) dl->AddPolyline(pts.data(), (int)pts.size(), col, ImDrawFlags_Closed, 4.0f); });
+    bench.Run("AddPolyline(), 4 px, no AA", 0, [&](ImDrawList* dl, const std::vector<ImVec2>& pts) { for (int n = 0; n < 10; n++) dl->AddPolyline(pts.data(), (int)pts.size(), col, ImDrawFlags_None, 4.0f); });
+    bench.Run("AddConvexPolyFilled(), AA", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>& pts) { for (int n = 0; n < 10; n++) dl->AddConvexPolyFilled(pts.data(), (int)pts.size(), col); });
+    bench.Run("AddConcavePolyFilled(), AA, 64 points", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>&) { for (int n = 0; n < 10; n++) dl->AddConcavePolyFilled(bench.Star.data(), (int)bench.Star.size(), col); });
+    bench.Run("AddCircle() r=4..400, x100, AA", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>&) { for (int n = 0; n < 100; n++) dl->AddCircle(ImVec2(960, 540), 4.0f + n * 4.0f, col, 0, 1.0f); });
+    bench.Run("AddCircleFilled() r=4..400, x100, AA", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>&) { for (int n = 0; n < 100; n++) dl->AddCircleFilled(ImVec2(960, 540), 4.0f + n * 4.0f, col); });
+
+
+    // Text: ~400 lines of code-like text, as a text editor or a log window would submit every frame
+    std::string text_ascii, text_long, text_utf8;
+    for (int n = 0; n < 400; n++)
+    {
+        char line[256];
+        snprintf(line, sizeof(line), "    if (value_%d > threshold) { result += compute(value_%d, %d); } // line %d\n", n, n, n * 7, n);
+        text_ascii += line;
+        text_long += std::string(line, strlen(line) - 1) + std::string(line, strlen(line) - 1) + line; // ~240 chars: mostly clipped at 600 px
+        snprintf(line, sizeof(line), "    r\xC3\xA9sultat_%d = calcul(\xC3\xA9l\xC3\xA9ment_%d); // \xC3\xA9tape %d\n", n, n, n);
+        text_utf8 += line;
+    }
+    ImFont* font = ImGui::GetFont();
+    const float font_size = ImGui::GetFontSize();
+    const ImVec4 clip_full(0.0f, 0.0f, 1920.0f, 1080.0f * 8.0f);
+    const ImVec4 clip_600(0.0f, 0.0f, 600.0f, 1080.0f * 8.0f);
+    printf("Text, 400 lines per block\n");
+    bench.Run("AddText(), ~80 chars lines, all visible", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>&) { dl->AddText(font, font_size, ImVec2(0, 0), col, text_ascii.c_str(), text_ascii.c_str() + text_ascii.size(), 0.0f, &clip_full); });
+    bench.Run("AddText(), ~240 chars lines, 600 px clip", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>&) { dl->AddText(font, font_size, ImVec2(0, 0), col, text_long.c_str(), text_long.c_str() + text_long.size(), 0.0f, &clip_600); });
+    bench.Run("AddText(), ~240 chars lines, wrapped at 600 px", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>&) { dl->AddText(font, font_size, ImVec2(0, 0), col, text_long.c_str(), text_long.c_str() + text_long.size(), 600.0f, &clip_full); });
+    bench.Run("AddText(), non-ASCII words, all visible", aa_all, [&](ImDrawList* dl, const std::vector<ImVec2>&) { dl->AddText(font, font_size, ImVec2(0, 0), col, text_utf8.c_str(), text_utf8.c_str() + text_utf8.size(), 0.0f, &clip_full); });
+
+    IM_DELETE(bench.DrawList);
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return 0;
+}
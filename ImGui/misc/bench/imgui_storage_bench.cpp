@@ -0,0 +1,122 @@
+// dear imgui
+// (command line tool: benchmark ImGuiStorage)
+
+// Measures ImGuiStorage insertion and lookup, and checks that lookups stay valid while ImGuiSelectionBasicStorage
+// iterates with PreserveOrder (which reorders the storage in place). Build it twice to compare the default sorted
+// storage with IMGUI_USE_HASHED_STORAGE:
+//   g++ -O2 -std=c++11 -I../.. imgui_storage_bench.cpp ../../imgui*.cpp -o imgui_storage_bench
+//   g++ -O2 -std=c++11 -I../.. -DIMGUI_USE_HASHED_STORAGE imgui_storage_bench.cpp ../../imgui*.cpp -o imgui_storage_bench_hashed
+// Returns non-zero if a check failed.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+static int g_fails = 0;
+#define CHECK(expr) do { if (!(expr)) { printf("FAILED: %s\n", #expr); g_fails++; } } while (0)
+
+static double GetTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Insert keys one by one (as SetInt() does during interactions), then look every key up 'lookup_passes' times.
+static void Bench(const char* name, const std::vector<ImGuiID>& keys, int lookup_passes)
+{
+    ImGuiStorage storage;
+    double t0 = GetTime();
+    for (size_t n = 0; n < keys.size(); n++)
+        storage.SetInt(keys[n], (int)n + 1);
+    double t1 = GetTime();
+    long long sum = 0;
+    for (int pass = 0; pass < lookup_passes; pass++)
+        for (size_t n = 0; n < keys.size(); n++)
+            sum += storage.GetInt(keys[n], 0);
+    double t2 = GetTime();
+    for (int pass = 0; pass < lookup_passes; pass++)
+        for (size_t n = 0; n < keys.size(); n++)
+            sum += storage.GetInt(keys[n] ^ 0x80000000, 0); // Misses (mostly)
+    double t3 = GetTime();
+    const double lookups = (double)keys.size() * lookup_passes;
+    printf("%-24s %7d keys: insert %8.2f ms, hit %6.2f ns/lookup, miss %6.2f ns/lookup (sum %lld)\n",
+        name, (int)keys.size(), (t1 - t0) * 1000.0, (t2 - t1) * 1e9 / lookups, (t3 - t2) * 1e9 / lookups, sum);
+}
+
+int main(int, char**)
+{
+#ifdef IMGUI_USE_HASHED_STORAGE
+    printf("ImGuiStorage: hashed (IMGUI_USE_HASHED_STORAGE)\n");
+#else
+    printf("ImGuiStorage: sorted\n");
+#endif
+
+    // Checks: lookups while GetNextSelectedItem() iterates in selection order
+    {
+        ImGuiSelectionBasicStorage selection;
+        selection.PreserveOrder = true;
+        const int count = 1000;
+        for (int n = count - 1; n >= 0; n--)
+            selection.SetItemSelected((ImGuiID)n * 7 + 1, true);
+        for (int pass = 0; pass < 2; pass++) // First pass ends with BuildSortByKey(), so the second one reorders Data[] in place
+        {
+            void* it = NULL;
+            ImGuiID id = 0;
+            int iterated = 0;
+            while (selection.GetNextSelectedItem(&it, &id))
+            {
+                CHECK(id == (ImGuiID)(count - 1 - iterated) * 7 + 1);
+#ifdef IMGUI_USE_HASHED_STORAGE
+                // Sorted storage is ordered by value during iteration, so only hashed storage supports this
+                if (iterated == 0)
+                    for (int n = 0; n < count; n++)
+                    {
+                        CHECK(selection.Contains((ImGuiID)n * 7 + 1));
+                        CHECK(!selection.Contains((ImGuiID)n * 7 + 2));
+                    }
+#endif
+                iterated++;
+            }
+            CHECK(iterated == count);
+        }
+        for (int n = 0; n < count; n++)
+            CHECK(selection.Contains((ImGuiID)n * 7 + 1));
+        selection.SetItemSelected(1, false);
+        CHECK(!selection.Contains(1) && selection.Size == count - 1);
+    }
+
+    // Checks: copies and BuildSortByKey() after direct Data[] writes
+    {
+        ImGuiStorage storage;
+        for (int n = 0; n < 100; n++)
+            storage.Data.push_back(ImGuiStoragePair((ImGuiID)(100 - n), n));
+        storage.BuildSortByKey();
+        ImGuiStorage copy = storage;
+        for (int n = 0; n < 100; n++)
+            CHECK(storage.GetInt((ImGuiID)(100 - n), -1) == n && copy.GetInt((ImGuiID)(100 - n), -1) == n);
+        CHECK(storage.GetInt(1000, -1) == -1);
+    }
+
+    // Benchmarks
+    std::mt19937 rng(1234);
+    for (int size : { 16, 256, 4096, 65536 })
+    {
+        const int passes = 4 * 1024 * 1024 / size;
+        std::vector<ImGuiID> keys;
+        for (int n = 0; n < size; n++)
+            keys.push_back(ImHashStr("Item", 0, ImHashData(&n, sizeof(n), 0x12345678)));
+        Bench("hashed IDs", keys, passes);
+        keys.clear();
+        for (int n = 0; n < size; n++)
+            keys.push_back((ImGuiID)n);
+        Bench("sequential indices", keys, passes);
+        std::shuffle(keys.begin(), keys.end(), rng);
+        Bench("shuffled indices", keys, passes);
+    }
+
+    printf(g_fails ? "%d check(s) FAILED\n" : "All checks passed\n", g_fails);
+    return g_fails ? 1 : 0;
+}
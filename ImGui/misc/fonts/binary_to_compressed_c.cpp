@@ -8,6 +8,8 @@
 // - As int:  ~11 bytes of source code for 4 bytes of input data. 4 bytes stored in binary. Endianness dependent, need swapping on big-endian CPU.
 // - As char: ~12 bytes of source code for 4 bytes of input data. 4 bytes stored in binary. Not endianness dependent.
 // Load compressed TTF fonts with ImGui::GetIO().Fonts->AddFontFromMemoryCompressedTTF()
+// Use -nocompress to embed the data as-is: ~4 times bigger, but loaded with ImGui::GetIO().Fonts->AddFontFromMemoryStaticTTF()
+// which uses the array in place: no decompression and no heap copy at startup.
 
 // Build with, e.g:
 //   # cl.exe binary_to_compressed_c.cpp
@@ -16,10 +18,11 @@
 // You can also find a precompiled Windows binary in the binary/demo package available from https://github.com/ocornut/imgui
 
 // Usage:
-//   binary_to_compressed_c.exe [-nocompress] [-nostatic] [-base85] <inputfile> <symbolname>
+//   binary_to_compressed_c.exe [-nocompress] [-nostatic] [-constexpr] [-base85] <inputfile> <symbolname>
 // Usage example:
 //   # binary_to_compressed_c.exe myfont.ttf MyFont > myfont.cpp
 //   # binary_to_compressed_c.exe -base85 myfont.ttf MyFont > myfont.cpp
+//   # binary_to_compressed_c.exe -nocompress -constexpr myfont.ttf MyFont > myfont.cpp
 // Note:
 //   Base85 encoding will be obsoleted by future version of Dear ImGui!
 
@@ -41,23 +44,28 @@ enum SourceEncoding
     SourceEncoding_Base85,
 };
 
-static bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static);
+static bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static, bool use_constexpr);
 
 int main(int argc, char** argv)
 {
     if (argc < 3)
     {
-        printf("Syntax: %s [-u8|-u32|-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
+        printf("Syntax: %s [-u8|-u32|-base85] [-nocompress] [-nostatic] [-constexpr] <inputfile> <symbolname>\n", argv[0]);
         printf("Source encoding types:\n");
         printf(" -u8     = ~12 bytes of source per 4 bytes of data. 4 bytes in binary.\n");
         printf(" -u32    = ~11 bytes of source per 4 bytes of data. 4 bytes in binary. Need endianness swapping on big-endian.\n");
         printf(" -base85 =  ~5 bytes of source per 4 bytes of data. 5 bytes in binary. Need decoder.\n");
+        printf("Options:\n");
+        printf(" -nocompress = store data as-is. With -u8, load with AddFontFromMemoryStaticTTF(): no decompression, no copy.\n");
+        printf(" -nostatic   = don't declare arrays as static.\n");
+        printf(" -constexpr  = declare arrays as constexpr instead of const (C++11).\n");
         return 0;
     }
 
     int argn = 1;
     bool use_compression = true;
     bool use_static = true;
+    bool use_constexpr = false;
     SourceEncoding source_encoding = SourceEncoding_U8; // New default
     while (argn < (argc - 2) && argv[argn][0] == '-')
     {
@@ -66,6 +74,7 @@ int main(int argc, char** argv)
         else if (strcmp(argv[argn], "-base85") == 0) { source_encoding = SourceEncoding_Base85; argn++; }
         else if (strcmp(argv[argn], "-nocompress") == 0) { use_compression = false; argn++; }
         else if (strcmp(argv[argn], "-nostatic") == 0) { use_static = false; argn++; }
+        else if (strcmp(argv[argn], "-constexpr") == 0) { use_constexpr = true; argn++; }
         else
         {
             fprintf(stderr, "Unknown argument: '%s'\n", argv[argn]);
@@ -73,7 +82,10 @@ int main(int argc, char** argv)
         }
     }
 
-    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], source_encoding, use_compression, use_static);
+    if (!use_compression && source_encoding == SourceEncoding_Base85)
+        fprintf(stderr, "Warning: -base85 output always needs decoding at runtime, use -u8 to embed data which can be used in place.\n");
+
+    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], source_encoding, use_compression, use_static, use_constexpr);
     if (!ret)
         fprintf(stderr, "Error opening or reading file: '%s'\n", argv[argn]);
     return ret ? 0 : 1;
@@ -85,7 +97,7 @@ char Encode85Byte(unsigned int x)
     return (char)((x >= '\\') ? x + 1 : x);
 }
 
-bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static)
+bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static, bool use_constexpr)
 {
     // Read file
     FILE* f = fopen(filename, "rb");
@@ -108,11 +120,12 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     FILE* out = stdout;
     fprintf(out, "// File: '%s' (%d bytes)\n", filename, (int)data_sz);
     const char* static_str = use_static ? "static " : "";
+    const char* const_str = use_constexpr ? "constexpr" : "const";
     const char* compressed_str = use_compression ? "compressed_" : "";
     if (source_encoding == SourceEncoding_Base85)
     {
         fprintf(out, "// Exported using binary_to_compressed_c.exe -base85 \"%s\" %s\n", filename, symbol);
-        fprintf(out, "%sconst char %s_%sdata_base85[%d+1] =\n    \"", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*5);
+        fprintf(out, "%s%s char %s_%sdata_base85[%d+1] =\n    \"", static_str, const_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*5);
         char prev_c = 0;
         for (int src_i = 0; src_i < compressed_sz; src_i += 4)
         {
@@ -133,8 +146,8 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     {
         // As individual bytes, not subject to endianness issues.
         fprintf(out, "// Exported using binary_to_compressed_c.exe -u8 \"%s\" %s\n", filename, symbol);
-        fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
-        fprintf(out, "%sconst unsigned char %s_%sdata[%d] =\n{", static_str, symbol, compressed_str, (int)compressed_sz);
+        fprintf(out, "%s%s unsigned int %s_%ssize = %d;\n", static_str, const_str, symbol, compressed_str, (int)compressed_sz);
+        fprintf(out, "%s%s unsigned char %s_%sdata[%d] =\n{", static_str, const_str, symbol, compressed_str, (int)compressed_sz);
         int column = 0;
         for (int i = 0; i < compressed_sz; i++)
         {
@@ -146,13 +159,15 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
                 column = 0;
         }
         fprintf(out, "\n};\n\n");
+        if (!use_compression)
+            fprintf(out, "// Load with: io.Fonts->AddFontFromMemoryStaticTTF(%s_data, %s_size, size_pixels);\n\n", symbol, symbol);
     }
     else if (source_encoding == SourceEncoding_U32)
     {
         // As integers
         fprintf(out, "// Exported using binary_to_compressed_c.exe -u32 \"%s\" %s\n", filename, symbol);
-        fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
-        fprintf(out, "%sconst unsigned int %s_%sdata[%d/4] =\n{", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*4);
+        fprintf(out, "%s%s unsigned int %s_%ssize = %d;\n", static_str, const_str, symbol, compressed_str, (int)compressed_sz);
+        fprintf(out, "%s%s unsigned int %s_%sdata[%d/4] =\n{", static_str, const_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*4);
         int column = 0;
         for (int i = 0; i < compressed_sz; i += 4)
         {
@@ -163,6 +178,8 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
                 fprintf(out, "0x%08x, ", d);
         }
         fprintf(out, "\n};\n\n");
+        if (!use_compression)
+            fprintf(out, "// Load with: io.Fonts->AddFontFromMemoryStaticTTF(%s_data, %s_size, size_pixels);\n\n", symbol, symbol);
     }
 
     // Cleanup
@@ -7,6 +7,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026/10/18: added support for ImFontFlags_LCD (subpixel coverage), rendered with FT_RENDER_MODE_LCD.
 //  2025/06/11: refactored for the new ImFontLoader architecture, and ImGuiBackendFlags_RendererHasTextures support.
 //  2024/10/17: added plutosvg support for SVG Fonts (seems faster/better than lunasvg). Enable by using '#define IMGUI_ENABLE_FREETYPE_PLUTOSVG'. (#7927)
 //  2023/11/13: added support for ImFontConfig::RasterizationDensity field for scaling render density without scaling metrics.
@@ -48,6 +49,7 @@
 #include FT_GLYPH_H             // <freetype/ftglyph.h>
 #include FT_SIZES_H             // <freetype/ftsizes.h>
 #include FT_SYNTHESIS_H         // <freetype/ftsynth.h>
+#include FT_LCD_FILTER_H        // <freetype/ftlcdfil.h>
 
 // Handle LunaSVG and PlutoSVG
 #if defined(IMGUI_ENABLE_FREETYPE_LUNASVG) && defined(IMGUI_ENABLE_FREETYPE_PLUTOSVG)
@@ -366,6 +368,9 @@ static bool ImGui_ImplFreeType_LoaderInit(ImFontAtlas* atlas)
     // If you don't call FT_Add_Default_Modules() the rest of code may work, but FreeType won't use our custom allocator.
     FT_Add_Default_Modules(bd->Library);
 
+    // Fonts using ImFontFlags_LCD are filtered by ImFontAtlasTextureBlockConvertLcd(). Disable FreeType's own filter when it is compiled in, so it isn't applied twice.
+    FT_Library_SetLcdFilter(bd->Library, FT_LCD_FILTER_NONE);
+
 #ifdef IMGUI_ENABLE_FREETYPE_LUNASVG
     // Install svg hooks for FreeType
     // https://freetype.org/freetype2/docs/reference/ft2-properties.html#svg-hooks
@@ -508,13 +513,17 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
     }
 
     // Render glyph into a bitmap (currently held by FreeType)
-    FT_Render_Mode render_mode = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : FT_RENDER_MODE_NORMAL;
+    FT_Render_Mode render_mode = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : baked->IsLcd ? FT_RENDER_MODE_LCD : FT_RENDER_MODE_NORMAL;
     FT_Error error = FT_Render_Glyph(slot, render_mode);
     const FT_Bitmap* ft_bitmap = &slot->bitmap;
     if (error != 0 || ft_bitmap == nullptr)
         return false;
 
-    const int w = (int)ft_bitmap->width;
+    // Subpixel coverage (see ImFontFlags_LCD): bitmap has 3 samples per pixel, and we add padding for filtering.
+    // Other glyphs of a LCD font (e.g. monochrome, bitmap or color glyphs) are expanded to 3 equal samples per pixel.
+    // FIXME: Color glyphs lose their colors in LCD fonts (documented limitation of ImFontFlags_LCD).
+    const bool is_lcd_bitmap = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_LCD);
+    const int w = (baked->IsLcd && ft_bitmap->width != 0) ? (int)(is_lcd_bitmap ? ft_bitmap->width / 3 : ft_bitmap->width) + IM_FONTBAKED_LCD_PADDING * 2 : (int)ft_bitmap->width;
     const int h = (int)ft_bitmap->rows;
     const bool is_visible = (w != 0 && h != 0);
 
@@ -528,16 +537,38 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
         ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
         if (pack_id == ImFontAtlasRectId_Invalid)
         {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight/TexPageSize set too small?)
             IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
             return false;
         }
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
         // Render pixels to our temporary buffer
-        atlas->Builder->TempBuffer.resize(w * h * 4);
-        uint32_t* temp_buffer = (uint32_t*)atlas->Builder->TempBuffer.Data;
-        ImGui_ImplFreeType_BlitGlyph(ft_bitmap, temp_buffer, w);
+        const int src_w = baked->IsLcd ? w - IM_FONTBAKED_LCD_PADDING * 2 : w;
+        uint32_t* temp_buffer = nullptr;
+        uint8_t* temp_subpixels = nullptr;
+        if (!baked->IsLcd)
+        {
+            atlas->Builder->TempBuffer.resize(w * h * 4);
+            temp_buffer = (uint32_t*)atlas->Builder->TempBuffer.Data;
+            ImGui_ImplFreeType_BlitGlyph(ft_bitmap, temp_buffer, w);
+        }
+        else if (is_lcd_bitmap)
+        {
+            atlas->Builder->TempBuffer.resize(src_w * 3 * h);
+            temp_subpixels = (uint8_t*)atlas->Builder->TempBuffer.Data;
+            for (int y = 0; y < h; y++)
+                memcpy(temp_subpixels + y * src_w * 3, ft_bitmap->buffer + y * ft_bitmap->pitch, (size_t)src_w * 3);
+        }
+        else
+        {
+            atlas->Builder->TempBuffer.resize(src_w * h * 4 + src_w * 3 * h);
+            temp_buffer = (uint32_t*)atlas->Builder->TempBuffer.Data;
+            temp_subpixels = (uint8_t*)(temp_buffer + src_w * h);
+            ImGui_ImplFreeType_BlitGlyph(ft_bitmap, temp_buffer, src_w);
+            for (int n = 0; n < src_w * h; n++)
+                temp_subpixels[n * 3 + 0] = temp_subpixels[n * 3 + 1] = temp_subpixels[n * 3 + 2] = (uint8_t)((temp_buffer[n] >> IM_COL32_A_SHIFT) & 0xFF);
+        }
 
         const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
@@ -551,16 +582,19 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
         float recip_v = 1.0f / rasterizer_density;
 
         // Register glyph
-        float glyph_off_x = (float)face->glyph->bitmap_left;
+        float glyph_off_x = (float)face->glyph->bitmap_left - (baked->IsLcd ? IM_FONTBAKED_LCD_PADDING : 0);
         float glyph_off_y = (float)-face->glyph->bitmap_top;
         out_glyph->X0 = glyph_off_x * recip_h + font_off_x;
         out_glyph->Y0 = glyph_off_y * recip_v + font_off_y;
         out_glyph->X1 = (glyph_off_x + w) * recip_h + font_off_x;
         out_glyph->Y1 = (glyph_off_y + h) * recip_v + font_off_y;
         out_glyph->Visible = true;
-        out_glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
+        out_glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA) && !baked->IsLcd;
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, (const unsigned char*)temp_buffer, ImTextureFormat_RGBA32, w * 4);
+        if (baked->IsLcd)
+            ImFontAtlasBakedSetFontGlyphBitmapLcd(atlas, baked, src, out_glyph, r, temp_subpixels, src_w * 3);
+        else
+            ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, (const unsigned char*)temp_buffer, ImTextureFormat_RGBA32, w * 4);
     }
 
     return true;
@@ -587,6 +621,7 @@ const ImFontLoader* ImGuiFreeType::GetFontLoader()
     loader.FontBakedDestroy = ImGui_ImplFreeType_FontBakedDestroy;
     loader.FontBakedLoadGlyph = ImGui_ImplFreeType_FontBakedLoadGlyph;
     loader.FontBakedSrcLoaderDataSize = sizeof(ImGui_ImplFreeType_FontSrcBakedData);
+    loader.HasLcd = true;
     return &loader;
 }
 
@@ -0,0 +1,167 @@
+// dear imgui
+// (command line tool: check ID hash function)
+
+// Counts 32-bit collisions of ImHashStr()/ImHashData() on typical ID patterns, checks "###" semantics,
+// and measures hashing throughput. Build it three times to compare the CRC32 hash (lookup table and SSE 4.2) with IMGUI_USE_FAST_ID_HASH:
+//   g++ -O2 -std=c++11 -I../.. imgui_hash_check.cpp ../../imgui*.cpp -o imgui_hash_check
+//   g++ -O2 -std=c++11 -msse4.2 -I../.. imgui_hash_check.cpp ../../imgui*.cpp -o imgui_hash_check_sse42
+//   g++ -O2 -std=c++11 -I../.. -DIMGUI_USE_FAST_ID_HASH imgui_hash_check.cpp ../../imgui*.cpp -o imgui_hash_check_fast
+// (IMGUI_USE_FAST_ID_HASH is ignored when SSE 4.2 is enabled)
+// Returns non-zero if a semantic check failed. Collisions are expected on random keys (birthday bound), but
+// should stay well below the birthday bound on structured keys (e.g. "Item %d", PushID(int) loops, pointers).
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+static int g_fails = 0;
+#define CHECK(expr) do { if (!(expr)) { printf("FAILED: %s\n", #expr); g_fails++; } } while (0)
+
+static size_t CountCollisions(std::vector<ImGuiID>& ids)
+{
+    std::sort(ids.begin(), ids.end());
+    size_t count = 0;
+    for (size_t n = 1; n < ids.size(); n++)
+        count += (ids[n] == ids[n - 1]);
+    return count;
+}
+
+// Reference "###" semantics: markers are matched left-to-right without overlap, the hash restarts after each one.
+static const char* SkipToLastMarker(const char* str, const char* str_end)
+{
+    const char* result = str;
+    for (const char* p = str; p < str_end; p++)
+        if (p[0] == '#' && p + 2 < str_end && p[1] == '#' && p[2] == '#')
+            result = (p += 2) + 1;
+    return result;
+}
+
+static double GetTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int, char**)
+{
+    const ImGuiID seed = 0x12345678;
+#ifdef IMGUI_ENABLE_FAST_ID_HASH
+    printf("Hash: IMGUI_USE_FAST_ID_HASH\n");
+#elif defined(IMGUI_ENABLE_SSE4_2_CRC)
+    printf("Hash: CRC32c (SSE 4.2)\n");
+#else
+    printf("Hash: CRC32 (lookup table)\n");
+#endif
+
+    // "###" semantics: hash restarts from seed after a "###" marker.
+    CHECK(ImHashStr("", 0, seed) == seed);
+    CHECK(ImHashStr("abc", 0, seed) == ImHashData("abc", 3, seed));
+    CHECK(ImHashStr("label###id", 0, seed) == ImHashStr("id", 0, seed));
+    CHECK(ImHashStr("label###id", 0, seed) == ImHashStr("###id", 0, seed));
+    CHECK(ImHashStr("a###b###id", 0, seed) == ImHashStr("id", 0, seed));
+    CHECK(ImHashStr("label##id", 0, seed) != ImHashStr("other##id", 0, seed));
+    CHECK(ImHashStr("label###id##", 10, seed) == ImHashStr("id", 0, seed));
+    CHECK(ImHashStr("ab###", 4, seed) == ImHashStr("ab##", 0, seed));
+    CHECK(ImHashStr("x###", 0, seed) == seed);
+    CHECK(ImHashStr("####id", 0, seed) == ImHashStr("#id", 0, seed)); // Markers are matched left-to-right
+    CHECK(ImHashStr("#####", 0, seed) == ImHashStr("##", 0, seed));
+    CHECK(ImHashStr("######id", 0, seed) == ImHashStr("id", 0, seed));
+
+    // Sized and zero-terminated strings hash the same, and only what follows the last marker contributes.
+    std::mt19937 rng(1);
+    for (int n = 0; n < 200000; n++)
+    {
+        char buf[80];
+        const int len = 1 + (int)(rng() % 70);
+        for (int i = 0; i < len; i++)
+            buf[i] = "#ab"[rng() % 3];
+        buf[len] = 0;
+        if (ImHashStr(buf, 0, seed) != ImHashStr(buf, (size_t)len, seed))
+        {
+            printf("FAILED: sized and zero-terminated hashes differ for \"%s\"\n", buf);
+            g_fails++;
+            break;
+        }
+        const char* suffix = SkipToLastMarker(buf, buf + len);
+        if (ImHashStr(buf, 0, seed) != ImHashData(suffix, (size_t)(buf + len - suffix), seed))
+        {
+            printf("FAILED: hash differs from hash of the part following the last marker for \"%s\"\n", buf);
+            g_fails++;
+            break;
+        }
+    }
+    printf("Semantic checks: %s\n", g_fails ? "FAILED" : "ok");
+
+    // Collisions
+    const int N = 1000000;
+    std::vector<ImGuiID> ids;
+    char buf[128];
+    ids.clear();
+    for (int n = 0; n < N; n++) { snprintf(buf, sizeof(buf), "Item %d", n); ids.push_back(ImHashStr(buf, 0, seed)); }
+    printf("Collisions, \"Item %%d\" x %d: %d\n", N, (int)CountCollisions(ids));
+    ids.clear();
+    for (int i = 0; i < 1000; i++)
+        for (int j = 0; j < 1000; j++) { snprintf(buf, sizeof(buf), "Node %d##tree", j); ids.push_back(ImHashStr(buf, 0, ImHashStr("parent", 0, (ImGuiID)i))); }
+    printf("Collisions, nested labels 1000x1000: %d\n", (int)CountCollisions(ids));
+    ids.clear();
+    for (int n = 0; n < N; n++) ids.push_back(ImHashData(&n, sizeof(int), seed));
+    printf("Collisions, PushID(int) x %d: %d\n", N, (int)CountCollisions(ids));
+    ids.clear();
+    for (int i = 0; i < 1000; i++)
+        for (int j = 0; j < 1000; j++) ids.push_back(ImHashData(&j, sizeof(int), ImHashData(&i, sizeof(int), seed)));
+    printf("Collisions, nested PushID(int) 1000x1000: %d\n", (int)CountCollisions(ids));
+    ids.clear();
+    for (int n = 0; n < N; n++) { const void* ptr = (const void*)((size_t)0x10000000 + (size_t)n * 16); ids.push_back(ImHashData(&ptr, sizeof(ptr), seed)); }
+    printf("Collisions, PushID(ptr) stride 16 x %d: %d\n", N, (int)CountCollisions(ids));
+    std::vector<std::string> random_strs;
+    for (int n = 0; n < N; n++)
+    {
+        std::string str;
+        for (int len = 4 + (int)(rng() % 29); len > 0; len--)
+            str += (char)('a' + rng() % 26);
+        random_strs.push_back(str);
+    }
+    std::sort(random_strs.begin(), random_strs.end());
+    random_strs.erase(std::unique(random_strs.begin(), random_strs.end()), random_strs.end());
+    ids.clear();
+    for (const std::string& str : random_strs)
+        ids.push_back(ImHashStr(str.c_str(), 0, seed));
+    printf("Collisions, random 4-32 chars x %d: %d (birthday bound ~%.0f)\n", (int)random_strs.size(), (int)CountCollisions(ids), (double)random_strs.size() * random_strs.size() / 2.0 / 4294967296.0);
+
+    // Throughput
+    const int lens[] = { 8, 16, 32, 64 };
+    for (int len : lens)
+    {
+        std::vector<std::string> labels;
+        for (int n = 0; n < 4096; n++)
+        {
+            std::string str;
+            for (int i = 0; i < len; i++)
+                str += (char)('a' + rng() % 26);
+            labels.push_back(str);
+        }
+        ImGuiID acc = 0;
+        const int repeat = 500;
+        const double t0 = GetTime();
+        for (int r = 0; r < repeat; r++)
+            for (const std::string& label : labels)
+                acc += ImHashStr(label.c_str(), 0, acc);
+        const double t1 = GetTime();
+        printf("ImHashStr(), %2d chars: %6.2f ns (%08X)\n", len, (t1 - t0) * 1e9 / (repeat * labels.size()), acc);
+    }
+    {
+        ImGuiID acc = 0;
+        const int repeat = 20000000;
+        const double t0 = GetTime();
+        for (int r = 0; r < repeat; r++)
+            acc = ImHashData(&r, sizeof(int), acc);
+        const double t1 = GetTime();
+        printf("ImHashData(), int: %6.2f ns (%08X)\n", (t1 - t0) * 1e9 / repeat, acc);
+    }
+
+    return g_fails ? 1 : 0;
+}
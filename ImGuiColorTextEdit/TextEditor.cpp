@@ -37,10 +37,13 @@ TextEditor::TextEditor()
 	, mTextStart(20.0f)
 	, mLeftMargin(10)
 	, mCursorPositionChanged(false)
+	, mCursorBlinking(false)
 	, mColorRangeMin(0)
 	, mColorRangeMax(0)
 	, mSelectionMode(SelectionMode::Normal)
 	, mCheckComments(true)
+	, mFixedPitch(false)
+	, mFontMetricsBakedId(0)
 	, mLastClick(-1.0f)
 	, mHandleKeyboardInputs(true)
 	, mHandleMouseInputs(true)
@@ -336,35 +339,83 @@ TextEditor::Coordinates TextEditor::ScreenPosToCoordinates(const ImVec2& aPositi
 		int columnIndex = 0;
 		float columnX = 0.0f;
 
-		while ((size_t)columnIndex < line.size())
+		if (mFixedPitch)
 		{
-			float columnWidth = 0.0f;
-
-			if (line[columnIndex].mChar == '\t')
+			// Fixed-pitch fast path: plain ASCII glyphs are all mCharAdvance.x wide, so the clicked cell follows
+			// from the pixel offset. Only tabs and multi-byte code points have to be stepped over one by one.
+			const float tabWidth = float(mTabSize) * mCharAdvance.x;
+			while ((size_t)columnIndex < line.size())
 			{
-				float spaceSize = ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, " ").x;
-				float oldX = columnX;
-				float newColumnX = (1.0f + std::floor((1.0f + columnX) / (float(mTabSize) * spaceSize))) * (float(mTabSize) * spaceSize);
-				columnWidth = newColumnX - oldX;
-				if (mTextStart + columnX + columnWidth * 0.5f > local.x)
-					break;
-				columnX = newColumnX;
-				columnCoord = (columnCoord / mTabSize) * mTabSize + mTabSize;
-				columnIndex++;
+				auto c = line[columnIndex].mChar;
+				if (c == '\t')
+				{
+					float newColumnX = (1.0f + std::floor((1.0f + columnX) / tabWidth)) * tabWidth;
+					if (mTextStart + columnX + (newColumnX - columnX) * 0.5f > local.x)
+						break;
+					columnX = newColumnX;
+					columnCoord = (columnCoord / mTabSize) * mTabSize + mTabSize;
+					columnIndex++;
+				}
+				else if (c < 0x80)
+				{
+					int target = (int)std::floor((local.x - mTextStart - columnX) / mCharAdvance.x + 0.5f);
+					int n = 0;
+					while (n < target && (size_t)(columnIndex + n) < line.size() && line[columnIndex + n].mChar != '\t' && line[columnIndex + n].mChar < 0x80)
+						++n;
+					columnIndex += n;
+					columnCoord += n;
+					columnX += float(n) * mCharAdvance.x;
+					if (n >= target)
+						break;
+				}
+				else
+				{
+					char buf[7];
+					auto d = UTF8CharLength(c);
+					int i = 0;
+					while (i < 6 && d-- > 0 && (size_t)columnIndex < line.size())
+						buf[i++] = line[columnIndex++].mChar;
+					buf[i] = '\0';
+					float columnWidth = ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, buf).x;
+					if (mTextStart + columnX + columnWidth * 0.5f > local.x)
+						break;
+					columnX += columnWidth;
+					columnCoord++;
+				}
 			}
-			else
+		}
+		else
+		{
+			while ((size_t)columnIndex < line.size())
 			{
-				char buf[7];
-				auto d = UTF8CharLength(line[columnIndex].mChar);
-				int i = 0;
-				while (i < 6 && d-- > 0)
-					buf[i++] = line[columnIndex++].mChar;
-				buf[i] = '\0';
-				columnWidth = ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, buf).x;
-				if (mTextStart + columnX + columnWidth * 0.5f > local.x)
-					break;
-				columnX += columnWidth;
-				columnCoord++;
+				float columnWidth = 0.0f;
+
+				if (line[columnIndex].mChar == '\t')
+				{
+					float spaceSize = ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, " ").x;
+					float oldX = columnX;
+					float newColumnX = (1.0f + std::floor((1.0f + columnX) / (float(mTabSize) * spaceSize))) * (float(mTabSize) * spaceSize);
+					columnWidth = newColumnX - oldX;
+					if (mTextStart + columnX + columnWidth * 0.5f > local.x)
+						break;
+					columnX = newColumnX;
+					columnCoord = (columnCoord / mTabSize) * mTabSize + mTabSize;
+					columnIndex++;
+				}
+				else
+				{
+					char buf[7];
+					auto d = UTF8CharLength(line[columnIndex].mChar);
+					int i = 0;
+					while (i < 6 && d-- > 0)
+						buf[i++] = line[columnIndex++].mChar;
+					buf[i] = '\0';
+					columnWidth = ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, buf).x;
+					if (mTextStart + columnX + columnWidth * 0.5f > local.x)
+						break;
+					columnX += columnWidth;
+					columnCoord++;
+				}
 			}
 		}
 	}
@@ -850,12 +901,29 @@ void TextEditor::HandleMouseInputs()
 	}
 }
 
-void TextEditor::Render()
+void TextEditor::UpdateFontMetrics()
 {
 	/* Compute mCharAdvance regarding to scaled font size (Ctrl + mouse wheel)*/
 	const float fontSize = ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, "#", nullptr, nullptr).x;
 	mCharAdvance = ImVec2(fontSize, ImGui::GetTextLineHeightWithSpacing() * mLineSpacing);
 
+	/* Sample the baked advances of printable ASCII to detect a fixed-pitch font, once per baked size */
+	ImFontBaked* baked = ImGui::GetFontBaked();
+	if (baked->BakedId != mFontMetricsBakedId)
+	{
+		mFontMetricsBakedId = baked->BakedId;
+		const float advance = baked->GetCharAdvance((ImWchar)'#');
+		mFixedPitch = advance > 0.0f;
+		for (ImWchar c = 0x20; c < 0x7F && mFixedPitch; ++c)
+			mFixedPitch = std::abs(baked->GetCharAdvance(c) - advance) < 0.01f;
+	}
+}
+
+void TextEditor::Render()
+{
+	UpdateFontMetrics();
+	mCursorBlinking = false;
+
 	/* Update palette with the current alpha from style */
 	for (int i = 0; i < (int)PaletteIndex::Max; ++i)
 	{
@@ -892,6 +960,8 @@ void TextEditor::Render()
 	if (!mLines.empty())
 	{
 		float spaceSize = ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, " ", nullptr, nullptr).x;
+		ImFontBaked* fontBaked = ImGui::GetFontBaked();
+		const float fontScale = ImGui::GetFontSize() / fontBaked->Size;
 
 		while (lineNo <= lineMax)
 		{
@@ -975,6 +1045,7 @@ void TextEditor::Render()
 				// Render the cursor
 				if (focused)
 				{
+					mCursorBlinking = true;
 					auto timeEnd = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 					auto elapsed = timeEnd - mStartTime;
 					if (elapsed > 400)
@@ -1009,36 +1080,31 @@ void TextEditor::Render()
 			}
 
 			// Render colorized text
-			auto prevColor = line.empty() ? mPalette[(int)PaletteIndex::Default] : GetGlyphColor(line[0]);
-			ImVec2 bufferOffset;
+			// Glyphs are gathered into runs of the same color. Whitespace carries no color, so spaces are merged into
+			// the surrounding run and only move the pen; a line costs one AddText() per color change (plus one per tab).
+			// Every glyph is measured once while being appended, so the pen never has to re-measure what was drawn.
+			auto runColor = mPalette[(int)PaletteIndex::Default];
+			float runStartX = 0.0f;
+			float penX = 0.0f;
 
 			for (int i = 0; i < line.size();)
 			{
 				auto& glyph = line[i];
-				auto color = GetGlyphColor(glyph);
-
-				if ((color != prevColor || glyph.mChar == '\t' || glyph.mChar == ' ') && !mLineBuffer.empty())
-				{
-					const ImVec2 newOffset(textScreenPos.x + bufferOffset.x, textScreenPos.y + bufferOffset.y);
-					drawList->AddText(newOffset, prevColor, mLineBuffer.c_str());
-					auto textSize = ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, mLineBuffer.c_str(), nullptr, nullptr);
-					bufferOffset.x += textSize.x;
-					mLineBuffer.clear();
-				}
-				prevColor = color;
 
 				if (glyph.mChar == '\t')
 				{
-					auto oldX = bufferOffset.x;
-					bufferOffset.x = (1.0f + std::floor((1.0f + bufferOffset.x) / (float(mTabSize) * spaceSize))) * (float(mTabSize) * spaceSize);
+					FlushLineBuffer(drawList, ImVec2(textScreenPos.x + runStartX, textScreenPos.y), runColor);
+					auto oldX = penX;
+					penX = (1.0f + std::floor((1.0f + penX) / (float(mTabSize) * spaceSize))) * (float(mTabSize) * spaceSize);
+					runStartX = penX;
 					++i;
 
 					if (mShowWhitespaces)
 					{
 						const auto s = ImGui::GetFontSize();
 						const auto x1 = textScreenPos.x + oldX + 1.0f;
-						const auto x2 = textScreenPos.x + bufferOffset.x - 1.0f;
-						const auto y = textScreenPos.y + bufferOffset.y + s * 0.5f;
+						const auto x2 = textScreenPos.x + penX - 1.0f;
+						const auto y = textScreenPos.y + s * 0.5f;
 						const ImVec2 p1(x1, y);
 						const ImVec2 p2(x2, y);
 						const ImVec2 p3(x2 - s * 0.2f, y - s * 0.2f);
@@ -1053,28 +1119,46 @@ void TextEditor::Render()
 					if (mShowWhitespaces)
 					{
 						const auto s = ImGui::GetFontSize();
-						const auto x = textScreenPos.x + bufferOffset.x + spaceSize * 0.5f;
-						const auto y = textScreenPos.y + bufferOffset.y + s * 0.5f;
+						const auto x = textScreenPos.x + penX + spaceSize * 0.5f;
+						const auto y = textScreenPos.y + s * 0.5f;
 						drawList->AddCircleFilled(ImVec2(x, y), 1.5f, 0x80808080, 4);
 					}
-					bufferOffset.x += spaceSize;
+					penX += spaceSize;
+					if (mLineBuffer.empty())
+						runStartX = penX;
+					else
+						mLineBuffer.push_back(' ');
 					i++;
 				}
 				else
 				{
+					auto color = GetGlyphColor(glyph);
+					if (color != runColor && !mLineBuffer.empty())
+					{
+						FlushLineBuffer(drawList, ImVec2(textScreenPos.x + runStartX, textScreenPos.y), runColor);
+						runStartX = penX;
+					}
+					runColor = color;
+
 					auto l = UTF8CharLength(glyph.mChar);
-					while (l-- > 0)
+					if (l == 1)
+					{
+						if (glyph.mChar != '\r')
+							penX += fontBaked->GetCharAdvance((ImWchar)glyph.mChar) * fontScale;
 						mLineBuffer.push_back(line[i++].mChar);
+					}
+					else
+					{
+						auto from = mLineBuffer.size();
+						while (l-- > 0 && i < (int)line.size())
+							mLineBuffer.push_back(line[i++].mChar);
+						penX += ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, mLineBuffer.c_str() + from, mLineBuffer.c_str() + mLineBuffer.size()).x;
+					}
 				}
 				++columnNo;
 			}
 
-			if (!mLineBuffer.empty())
-			{
-				const ImVec2 newOffset(textScreenPos.x + bufferOffset.x, textScreenPos.y + bufferOffset.y);
-				drawList->AddText(newOffset, prevColor, mLineBuffer.c_str());
-				mLineBuffer.clear();
-			}
+			FlushLineBuffer(drawList, ImVec2(textScreenPos.x + runStartX, textScreenPos.y), runColor);
 
 			++lineNo;
 		}
@@ -1117,6 +1201,16 @@ void TextEditor::Render()
 	}
 }
 
+// Draws the pending color run in mLineBuffer, if any. The caller already advanced its pen while appending
+// the glyphs, so the run is not measured again.
+void TextEditor::FlushLineBuffer(ImDrawList* aDrawList, const ImVec2& aPos, ImU32 aColor)
+{
+	if (mLineBuffer.empty())
+		return;
+	aDrawList->AddText(aPos, aColor, mLineBuffer.c_str(), mLineBuffer.c_str() + mLineBuffer.size());
+	mLineBuffer.clear();
+}
+
 void TextEditor::Render(const char* aTitle, const ImVec2& aSize, bool aBorder)
 {
 	mWithinRender = true;
@@ -2126,6 +2220,25 @@ std::string TextEditor::GetCurrentLineText()const
 		Coordinates(mState.mCursorPosition.mLine, lineLength));
 }
 
+int TextEditor::GetNextWakeupTimeout() const
+{
+	if (mColorizerEnabled && (mCheckComments || mColorRangeMin < mColorRangeMax))
+		return 0;
+	if (mScrollToCursor)
+		return 0;
+	if (!mCursorBlinking)
+		return -1;
+
+	// Render() shows the cursor once 400ms have elapsed since mStartTime and restarts the cycle after 800ms
+	auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	auto elapsed = (int64_t)(now - mStartTime);
+	if (elapsed <= 400)
+		return (int)(401 - elapsed);
+	if (elapsed <= 800)
+		return (int)(801 - elapsed);
+	return 0;
+}
+
 void TextEditor::ProcessInputs()
 {
 }
@@ -2391,6 +2504,9 @@ void TextEditor::ColorizeInternal()
 float TextEditor::TextDistanceToLineStart(const Coordinates& aFrom) const
 {
 	auto& line = mLines[aFrom.mLine];
+	if (mFixedPitch)
+		return MonospaceDistanceToIndex(line, GetCharacterIndex(aFrom));
+
 	float distance = 0.0f;
 	float spaceSize = ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, " ", nullptr, nullptr).x;
 	int colIndex = GetCharacterIndex(aFrom);
@@ -2417,6 +2533,48 @@ float TextEditor::TextDistanceToLineStart(const Coordinates& aFrom) const
 	return distance;
 }
 
+// Fixed-pitch variant of TextDistanceToLineStart: runs of plain ASCII glyphs advance by mCharAdvance.x each,
+// only tabs (stops are pixel based) and multi-byte code points (which may be wide, e.g. CJK) are measured.
+float TextEditor::MonospaceDistanceToIndex(const Line& aLine, int aIndex) const
+{
+	const int end = std::min(aIndex, (int)aLine.size());
+	const float tabWidth = float(mTabSize) * mCharAdvance.x;
+	float distance = 0.0f;
+	int runStart = 0;
+	for (int it = 0; it < end; )
+	{
+		auto c = aLine[it].mChar;
+		if (c != '\t' && c < 0x80)
+		{
+			++it;
+			continue;
+		}
+
+		distance += float(it - runStart) * mCharAdvance.x;
+		if (c == '\t')
+		{
+			distance = (1.0f + std::floor((1.0f + distance) / tabWidth)) * tabWidth;
+			++it;
+		}
+		else
+		{
+			auto d = UTF8CharLength(c);
+			char tempCString[7];
+			int i = 0;
+			for (; i < 6 && d-- > 0 && it < (int)aLine.size(); i++, it++)
+				tempCString[i] = aLine[it].mChar;
+
+			tempCString[i] = '\0';
+			distance += ImGui::GetFont()->CalcTextSizeA(ImGui::GetFontSize(), FLT_MAX, -1.0f, tempCString, nullptr, nullptr).x;
+		}
+		runStart = it;
+	}
+
+	if (runStart < end)
+		distance += float(end - runStart) * mCharAdvance.x;
+	return distance;
+}
+
 void TextEditor::EnsureCursorVisible()
 {
 	if (!mWithinRender)
@@ -213,6 +213,10 @@ public:
 	bool IsTextChanged() const { return mTextChanged; }
 	bool IsCursorPositionChanged() const { return mCursorPositionChanged; }
 
+	// Idle hint for event-driven main loops: milliseconds until the editor has to be rendered again without
+	// any new input (pending colorization, cursor blink), or -1 if only input can change what it displays.
+	int GetNextWakeupTimeout() const;
+
 	bool IsColorizerEnabled() const { return mColorizerEnabled; }
 	void SetColorizerEnable(bool aValue);
 
@@ -317,6 +321,8 @@ private:
 	void ColorizeRange(int aFromLine = 0, int aToLine = 0);
 	void ColorizeInternal();
 	float TextDistanceToLineStart(const Coordinates& aFrom) const;
+	float MonospaceDistanceToIndex(const Line& aLine, int aIndex) const;
+	void UpdateFontMetrics();
 	void EnsureCursorVisible();
 	int GetPageSize() const;
 	std::string GetText(const Coordinates& aStart, const Coordinates& aEnd) const;
@@ -348,6 +354,7 @@ private:
 	void HandleKeyboardInputs();
 	void HandleMouseInputs();
 	void Render();
+	void FlushLineBuffer(ImDrawList* aDrawList, const ImVec2& aPos, ImU32 aColor);
 
 	float mLineSpacing;
 	Lines mLines;
@@ -366,6 +373,7 @@ private:
 	float mTextStart;                   // position (in pixels) where a code line starts relative to the left of the TextEditor.
 	int  mLeftMargin;
 	bool mCursorPositionChanged;
+	bool mCursorBlinking;               // the cursor was drawn in a focused window during the last Render(), see mStartTime.
 	int mColorRangeMin, mColorRangeMax;
 	SelectionMode mSelectionMode;
 	bool mHandleKeyboardInputs;
@@ -382,6 +390,8 @@ private:
 	Breakpoints mBreakpoints;
 	ErrorMarkers mErrorMarkers;
 	ImVec2 mCharAdvance;
+	bool mFixedPitch;                   // every printable ASCII glyph of the current font has the same advance (mCharAdvance.x).
+	ImGuiID mFontMetricsBakedId;        // ImFontBaked::BakedId mFixedPitch was sampled from.
 	Coordinates mInteractiveStart, mInteractiveEnd;
 	std::string mLineBuffer;
 	uint64_t mStartTime;
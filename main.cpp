@@ -149,6 +149,45 @@ bool SaveFile(const std::string& filePath, const TextEditor& editor) {
     return true;
 }
 
+// What the main loop needs to remember to tell whether Dear ImGui settled after the last input event
+struct IdleState
+{
+    int     FramesSinceInput = 0;
+    double  LastInputTime = 0.0;
+    int     RenderWindows = 0, RenderVertices = 0, RenderIndices = 0;
+};
+
+// Returns true while Dear ImGui will keep changing without new input events, so the main loop can't sleep yet.
+// Only public state is used:
+// - an item is active, or a key or mouse button is held down (key repeat, drag-selecting in the text editor),
+// - input was received less than 2 frames ago: Dear ImGui applies some changes one frame late (popups appearing, navigation, scroll requests),
+// - the last frame changed the number of rendered windows or vertices (popups and windows appearing or auto-resizing),
+// - the mouse rests on an item for less than the hover delays (tooltips, menus opening on hover).
+static bool ImGuiWantsMoreFrames(IdleState& idle)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const bool output_changed = io.MetricsRenderWindows != idle.RenderWindows || io.MetricsRenderVertices != idle.RenderVertices || io.MetricsRenderIndices != idle.RenderIndices;
+    idle.RenderWindows = io.MetricsRenderWindows;
+    idle.RenderVertices = io.MetricsRenderVertices;
+    idle.RenderIndices = io.MetricsRenderIndices;
+    idle.FramesSinceInput++;
+
+    if (ImGui::IsAnyItemActive() || ImGui::IsAnyMouseDown())
+        return true;
+    for (int key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_ReservedForModCtrl; key++)
+        if (ImGui::IsKeyDown((ImGuiKey)key))
+            return true;
+    if (idle.FramesSinceInput < 2 || output_changed)
+        return true;
+
+    // Hover timers start on the frame after the mouse stopped: allow a few frames of margin
+    const ImGuiStyle& style = ImGui::GetStyle();
+    const float hover_delay = (style.HoverDelayNormal > style.HoverStationaryDelay ? style.HoverDelayNormal : style.HoverStationaryDelay) + 0.10f;
+    if (ImGui::IsAnyItemHovered() && ImGui::GetTime() - idle.LastInputTime < hover_delay)
+        return true;
+    return false;
+}
+
 // Main code
 int main(int, char**)
 {
@@ -241,6 +280,10 @@ int main(int, char**)
     ImGui_ImplSDL2_InitForOpenGL(window, gl_context);
     ImGui_ImplOpenGL3_Init(glsl_version);
 
+    // Skip presenting frames which would look exactly like the one on screen.
+    // SDL doesn't tell us the age of the back buffer, so any change still redraws the whole window.
+    ImGui_ImplOpenGL3_SetDamageTracking(true, 0);
+
     // Create text editor instance
     TextEditor editor;
     editor.SetLanguageDefinition(TextEditor::LanguageDefinition::CPlusPlus()); // Set language definition
@@ -256,6 +299,15 @@ int main(int, char**)
     std::string currentFilePath = "";
     bool fileModified = false;
 
+    // Idle frame skipping: instead of rendering continuously at vsync, the main loop sleeps in SDL_WaitEventTimeout()
+    // once nothing changes. After input, frames keep coming until ImGuiWantsMoreFrames() reports that Dear ImGui settled.
+    // Without input, the editor tells when it needs its next frame.
+    const int skipped_frame_wait = 16; // When a frame isn't presented, vsync doesn't pace the loop anymore
+    IdleState idle;
+    bool wants_frames = true;
+    int next_wakeup = -1;
+    bool frame_skipped = false;
+
     // Main loop
     bool done = false;
 #ifdef __EMSCRIPTEN__
@@ -273,8 +325,17 @@ int main(int, char**)
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
         SDL_Event event;
-        while (SDL_PollEvent(&event))
+        bool has_event = SDL_PollEvent(&event) != 0;
+#ifndef __EMSCRIPTEN__
+        if (!has_event && !wants_frames)
+            has_event = SDL_WaitEventTimeout(&event, next_wakeup) != 0;
+        else if (!has_event && frame_skipped)
+            has_event = SDL_WaitEventTimeout(&event, skipped_frame_wait) != 0;
+#endif
+        for (; has_event; has_event = SDL_PollEvent(&event) != 0)
         {
+            idle.FramesSinceInput = 0;
+            idle.LastInputTime = ImGui::GetTime();
             ImGui_ImplSDL2_ProcessEvent(&event);
             if (event.type == SDL_QUIT) {
                 // Check if file has been modified before quitting
@@ -297,6 +358,9 @@ int main(int, char**)
         }
         if (SDL_GetWindowFlags(window) & SDL_WINDOW_MINIMIZED)
         {
+            // Nothing to draw: sleep until an event restores the window
+            wants_frames = false;
+            next_wakeup = -1;
             SDL_Delay(10);
             continue;
         }
@@ -480,11 +544,24 @@ int main(int, char**)
 
         // Rendering
         ImGui::Render();
-        glViewport(0, 0, (int)io.DisplaySize.x, (int)io.DisplaySize.y);
-        glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
-        glClear(GL_COLOR_BUFFER_BIT);
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-        SDL_GL_SwapWindow(window);
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        int damage_box[4];
+        frame_skipped = !ImGui_ImplOpenGL3_ComputeDamage(draw_data, damage_box);
+        if (!frame_skipped)
+        {
+            glViewport(0, 0, (int)io.DisplaySize.x, (int)io.DisplaySize.y);
+            glEnable(GL_SCISSOR_TEST);
+            glScissor(damage_box[0], damage_box[1], damage_box[2], damage_box[3]);
+            glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
+            glClear(GL_COLOR_BUFFER_BIT);
+            glDisable(GL_SCISSOR_TEST);
+            ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+            SDL_GL_SwapWindow(window);
+        }
+
+        // Decide whether the next iteration may block waiting for input
+        next_wakeup = editor.GetNextWakeupTimeout();
+        wants_frames = ImGuiWantsMoreFrames(idle) || next_wakeup == 0;
     }
 #ifdef __EMSCRIPTEN__
     EMSCRIPTEN_MAINLOOP_END;